@@ -12,6 +12,7 @@ public class MOInventory : ModuleRules
         PublicDependencyModuleNames.AddRange(new[]
         {
             "Core", "CoreUObject", "Engine", "InputCore",
+            "NetCore",
             "MOItems" // needed to see UItemData across modules
         });
 
@@ -4,16 +4,15 @@
 #include "InventoryComponent.h"
 #include "ItemData.h"
 #include "ItemPickup.h"
-
-#include "Engine/SkeletalMesh.h"
-#include "Engine/StaticMesh.h"
-#include "PhysicsEngine/BodySetup.h"
-#include "PhysicsEngine/PhysicsAsset.h"
-#include "PhysicsEngine/SkeletalBodySetup.h"
+#include "ItemPickupPool.h"
 
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
+#include "GameFramework/Controller.h"
+#include "Algo/BinarySearch.h"
+#include "HAL/IConsoleManager.h"
 #include "TimerManager.h"
+#include "UObject/CoreNet.h"
 #include "UObject/Package.h"
 #include "Net/UnrealNetwork.h"
 
@@ -23,9 +22,21 @@
 
 DEFINE_LOG_CATEGORY_STATIC(LogMOInventoryComponent, Log, All);
 
+#if !UE_BUILD_SHIPPING
+namespace
+{
+    static TAutoConsoleVariable<int32> CVarValidateInventoryTotals(
+        TEXT("MO56.Inventory.ValidateTotals"),
+        UE_BUILD_DEBUG ? 1 : 0,
+        TEXT("Recompute inventory weight/volume and item counts whenever an inventory broadcasts a change and ensure the running caches have not drifted."),
+        ECVF_Cheat);
+}
+#endif
+
 UInventoryComponent::UInventoryComponent()
 {
     PrimaryComponentTick.bCanEverTick = false;
+    SlotArray.Owner = this;
     EnsureSlotCapacity();
     SetIsReplicatedByDefault(true);
 }
@@ -38,10 +49,266 @@ void UInventoryComponent::PostInitProperties()
     {
         EnsurePersistentId();
     }
+
+    RebuildSparseSlotLookup();
+    RebuildSlotCaches();
+}
+
+void UInventoryComponent::PostLoad()
+{
+    Super::PostLoad();
+
+    RebuildSparseSlotLookup();
+    RebuildSlotCaches();
+}
+
+bool FInventorySlotArray::NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+{
+    if (DeltaParms.Reader && !bReceivedServerSlots)
+    {
+        // Slots sized locally before the first update have no replication ID; the server's copy replaces them.
+        Items.RemoveAll([](const FItemStack& Slot) { return Slot.ReplicationID == INDEX_NONE; });
+        bReceivedServerSlots = true;
+
+        if (Owner)
+        {
+            Owner->ReplicatedSlotShadow.Reset();
+            Owner->RebuildSlotCaches();
+        }
+    }
+
+    return FFastArraySerializer::FastArrayDeltaSerialize<FItemStack, FInventorySlotArray>(Items, DeltaParms, *this);
+}
+
+void FInventorySlotArray::PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize)
+{
+    // Removed entries are swapped out on the client, which can leave the remaining slots out of order.
+    bNeedsSlotOrderFixup |= RemovedIndices.Num() > 0;
+
+    if (!Owner)
+    {
+        return;
+    }
+
+    for (const int32 Index : RemovedIndices)
+    {
+        Owner->HandleReplicatedSlotRemoved(Items[Index]);
+    }
 }
 
-void UInventoryComponent::OnRep_Slots()
+void FInventorySlotArray::PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize)
 {
+    for (const int32 Index : AddedIndices)
+    {
+        const FItemStack& Slot = Items[Index];
+        bNeedsSlotOrderFixup |= Slot.SlotIndex != Index;
+
+        if (Owner)
+        {
+            Owner->HandleReplicatedSlotUpdated(Slot, EInventorySlotChange::Added);
+        }
+    }
+}
+
+void FInventorySlotArray::PostReplicatedChange(const TArrayView<int32> ChangedIndices, int32 FinalSize)
+{
+    if (!Owner)
+    {
+        return;
+    }
+
+    for (const int32 Index : ChangedIndices)
+    {
+        Owner->HandleReplicatedSlotUpdated(Items[Index], EInventorySlotChange::Changed);
+    }
+}
+
+void FInventorySlotArray::PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters)
+{
+    if (bNeedsSlotOrderFixup)
+    {
+        // Restore slot order and let the ID map rebuild on the next update. Sparse entries are found
+        // through the owner's lookup instead, so their order does not matter.
+        if (!Owner || !Owner->UsesSparseStorage())
+        {
+            Items.Sort([](const FItemStack& A, const FItemStack& B) { return A.SlotIndex < B.SlotIndex; });
+            ItemMap.Reset();
+        }
+
+        bNeedsSlotOrderFixup = false;
+    }
+
+    if (Owner)
+    {
+        Owner->HandleSlotsReplicated();
+    }
+}
+
+void UInventoryComponent::HandleReplicatedSlotUpdated(const FItemStack& Slot, EInventorySlotChange Change)
+{
+    if (Slot.SlotIndex < 0)
+    {
+        return;
+    }
+
+    if (UsesSparseStorage())
+    {
+        // Sparse clients keep no per-slot shadow; HandleSlotsReplicated rebuilds the caches from the stored entries.
+        PendingChangedSlots.Add(Slot.SlotIndex);
+        OnSlotReplicated.Broadcast(Slot.SlotIndex, Change);
+        return;
+    }
+
+    if (!ReplicatedSlotShadow.IsValidIndex(Slot.SlotIndex))
+    {
+        ReplicatedSlotShadow.SetNum(Slot.SlotIndex + 1);
+    }
+
+    PendingChangedSlots.Add(Slot.SlotIndex);
+    bPendingLayoutChange |= Change == EInventorySlotChange::Added;
+
+    // While predictions are pending the caches follow the predicted slots; ReconcilePredictions rebuilds them.
+    const bool bUpdateCaches = !HasPendingPredictions();
+    FItemStack& Shadow = ReplicatedSlotShadow[Slot.SlotIndex];
+    if (bUpdateCaches)
+    {
+        RemoveSlotFromCaches(Slot.SlotIndex, Shadow);
+    }
+
+    Shadow.Item = Slot.Item;
+    Shadow.Quantity = Slot.Quantity;
+
+    if (bUpdateCaches)
+    {
+        AddSlotToCaches(Slot.SlotIndex, Shadow);
+    }
+
+    OnSlotReplicated.Broadcast(Slot.SlotIndex, Change);
+}
+
+void UInventoryComponent::HandleReplicatedSlotRemoved(const FItemStack& Slot)
+{
+    if (UsesSparseStorage())
+    {
+        // A sparse slot leaving the array just became empty; the slot count is unchanged.
+        PendingChangedSlots.Add(Slot.SlotIndex);
+        OnSlotReplicated.Broadcast(Slot.SlotIndex, EInventorySlotChange::Removed);
+        return;
+    }
+
+    if (ReplicatedSlotShadow.IsValidIndex(Slot.SlotIndex))
+    {
+        FItemStack& Shadow = ReplicatedSlotShadow[Slot.SlotIndex];
+        if (!HasPendingPredictions())
+        {
+            RemoveSlotFromCaches(Slot.SlotIndex, Shadow);
+        }
+
+        Shadow.Item = nullptr;
+        Shadow.Quantity = 0;
+    }
+
+    PendingChangedSlots.Add(Slot.SlotIndex);
+    bPendingLayoutChange = true;
+
+    OnSlotReplicated.Broadcast(Slot.SlotIndex, EInventorySlotChange::Removed);
+}
+
+void UInventoryComponent::HandleSlotsReplicated()
+{
+    FInventoryTransaction Transaction(this);
+    if (UsesSparseStorage())
+    {
+        RebuildSparseSlotLookup();
+        RebuildSlotCaches();
+    }
+
+    ReconcilePredictions(true);
+
+    MarkInventoryUpdateSource(EInventoryUpdateSource::PlayerAction);
+    BroadcastInventoryChanged();
+}
+
+bool UInventoryComponent::IsOwnedByLocalConnection() const
+{
+    const AActor* OwnerActor = GetOwner();
+    return OwnerActor && OwnerActor->GetNetConnection() != nullptr;
+}
+
+bool UInventoryComponent::PredictCommand(const FInventoryCommand& Command)
+{
+    const int32 PredictionKey = SubmitCommands({ Command });
+
+    FPredictedInventoryCommand& Prediction = PredictedCommands.AddDefaulted_GetRef();
+    Prediction.PredictionKey = PredictionKey;
+    Prediction.Command = Command;
+
+    return ApplyPredictedCommand(Command);
+}
+
+bool UInventoryComponent::ApplyPredictedCommand(const FInventoryCommand& Command)
+{
+    TGuardValue<bool> PredictionGuard(bApplyingPrediction, true);
+
+    switch (Command.Type)
+    {
+    case EInventoryCommandType::Move:
+    case EInventoryCommandType::Merge:
+        return TransferItemBetweenSlots(Command.SourceSlot, Command.TargetSlot);
+
+    case EInventoryCommandType::Split:
+        return SplitStackAtIndex(Command.SourceSlot);
+
+    default:
+        return false;
+    }
+}
+
+void UInventoryComponent::ReconcilePredictions(bool bRetireAcknowledged)
+{
+    if (!HasPendingPredictions())
+    {
+        return;
+    }
+
+    FInventoryTransaction Transaction(this);
+
+    if (!IsOwnedByLocalConnection())
+    {
+        // Ownership moved on (for example to another player opening the container); no acknowledgement will follow.
+        PredictedCommands.Reset();
+    }
+    else if (bRetireAcknowledged)
+    {
+        // The server sends the acknowledgement before replicating the slots it changed, on the same channel, so a slot
+        // update arriving after an acknowledgement already contains that batch.
+        PredictedCommands.RemoveAll([](const FPredictedInventoryCommand& Prediction)
+        {
+            return Prediction.bAcknowledged;
+        });
+    }
+
+    for (const int32 SlotIndex : PredictedSlots)
+    {
+        if (SlotArray.Items.IsValidIndex(SlotIndex) && ReplicatedSlotShadow.IsValidIndex(SlotIndex))
+        {
+            FItemStack& Slot = SlotArray.Items[SlotIndex];
+            Slot.Item = ReplicatedSlotShadow[SlotIndex].Item;
+            Slot.Quantity = ReplicatedSlotShadow[SlotIndex].Quantity;
+            PendingChangedSlots.Add(SlotIndex);
+        }
+    }
+
+    PredictedSlots.Reset();
+    RebuildSlotCaches();
+
+    // Replay what is still in flight on top of the authoritative state; a replay that no longer applies
+    // stays queued so the server's answer still retires it.
+    for (const FPredictedInventoryCommand& Prediction : PredictedCommands)
+    {
+        ApplyPredictedCommand(Prediction.Command);
+    }
+
     MarkInventoryUpdateSource(EInventoryUpdateSource::PlayerAction);
     BroadcastInventoryChanged();
 }
@@ -73,7 +340,102 @@ void UInventoryComponent::ServerTransferItemBetweenSlots_Implementation(int32 So
 
 void UInventoryComponent::ServerTransferItemToInventory_Implementation(UInventoryComponent* TargetInventory, int32 SourceSlotIndex, int32 TargetSlotIndex)
 {
-    TransferItemToInventory(TargetInventory, SourceSlotIndex, TargetSlotIndex);
+    if (CanRequesterUse(TargetInventory))
+    {
+        TransferItemToInventory(TargetInventory, SourceSlotIndex, TargetSlotIndex);
+    }
+}
+
+void UInventoryComponent::ServerSortSlots_Implementation()
+{
+    SortSlots();
+}
+
+void UInventoryComponent::ServerTakeAllFromInventory_Implementation(UInventoryComponent* SourceInventory)
+{
+    if (CanRequesterUse(SourceInventory))
+    {
+        TakeAllFromInventory(SourceInventory);
+    }
+}
+
+void UInventoryComponent::ServerExecuteCommands_Implementation(const TArray<FInventoryCommand>& Commands, int32 Sequence)
+{
+    // One inaccessible inventory anywhere in the batch rejects all of it.
+    bool bAccessible = CanRequesterUse(nullptr);
+    for (const FInventoryCommand& Command : Commands)
+    {
+        bAccessible &= !Command.OtherInventory || CanRequesterUse(Command.OtherInventory);
+    }
+
+    if (!bAccessible)
+    {
+        UE_LOG(LogMOInventoryComponent, Warning, TEXT("Rejected inventory command batch from %s on %s: inventory not accessible."),
+            *GetNameSafe(GetOwningController()), *GetNameSafe(GetOwner()));
+    }
+
+    const bool bSucceeded = bAccessible && ApplyCommandBatch(Commands);
+    ClientAcknowledgeCommands(Sequence, bSucceeded);
+}
+
+AController* UInventoryComponent::GetOwningController() const
+{
+    for (AActor* Actor = GetOwner(); Actor; Actor = Actor->GetOwner())
+    {
+        if (AController* Controller = Cast<AController>(Actor))
+        {
+            return Controller;
+        }
+    }
+
+    return nullptr;
+}
+
+bool UInventoryComponent::CanBeAccessedBy(const AController* Requester) const
+{
+    if (!Requester)
+    {
+        return false;
+    }
+
+    if (AccessCheck.IsBound())
+    {
+        return AccessCheck.Execute(Requester);
+    }
+
+    return GetOwningController() == Requester;
+}
+
+bool UInventoryComponent::CanRequesterUse(const UInventoryComponent* Other) const
+{
+    const AController* Requester = GetOwningController();
+    return CanBeAccessedBy(Requester) && (!Other || Other->CanBeAccessedBy(Requester));
+}
+
+void UInventoryComponent::ClientAcknowledgeCommands_Implementation(int32 Sequence, bool bSucceeded)
+{
+    // Sequences are per client; this RPC only reaches the connection that sent the batch.
+    if (FPredictedInventoryCommand* Prediction = PredictedCommands.FindByPredicate([Sequence](const FPredictedInventoryCommand& Candidate)
+        {
+            return Candidate.PredictionKey == Sequence;
+        }))
+    {
+        if (bSucceeded)
+        {
+            Prediction->bAcknowledged = true;
+        }
+        else
+        {
+            // A rejected batch changed nothing on the server, so its prediction can be undone right away.
+            PredictedCommands.RemoveAll([Sequence](const FPredictedInventoryCommand& Candidate)
+            {
+                return Candidate.PredictionKey == Sequence;
+            });
+            ReconcilePredictions(false);
+        }
+    }
+
+    OnCommandsAcknowledged.Broadcast(Sequence, bSucceeded);
 }
 
 void UInventoryComponent::ServerDebugSetSlot_Implementation(int32 SlotIndex, UItemData* Item, int32 Quantity)
@@ -92,7 +454,41 @@ void UInventoryComponent::InitializeComponent()
 void UInventoryComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-    DOREPLIFETIME(UInventoryComponent, Slots);
+    DOREPLIFETIME(UInventoryComponent, SparseSlotCount);
+    DOREPLIFETIME(UInventoryComponent, SlotArray);
+}
+
+bool FInventoryCommand::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+    uint8 TypeValue = static_cast<uint8>(Type);
+    Ar << TypeValue;
+
+    // Offset by one so INDEX_NONE and small slot indices pack into a single byte.
+    uint32 PackedSource = static_cast<uint32>(SourceSlot + 1);
+    uint32 PackedTarget = static_cast<uint32>(TargetSlot + 1);
+    Ar.SerializeIntPacked(PackedSource);
+    Ar.SerializeIntPacked(PackedTarget);
+
+    uint8 bHasOtherInventory = OtherInventory != nullptr ? 1 : 0;
+    Ar.SerializeBits(&bHasOtherInventory, 1);
+
+    bOutSuccess = true;
+    UObject* OtherObject = OtherInventory;
+    if (bHasOtherInventory)
+    {
+        bOutSuccess = Map && Map->SerializeObject(Ar, UInventoryComponent::StaticClass(), OtherObject);
+    }
+
+    if (Ar.IsLoading())
+    {
+        bOutSuccess &= TypeValue <= static_cast<uint8>(EInventoryCommandType::TakeAll);
+        Type = static_cast<EInventoryCommandType>(TypeValue);
+        SourceSlot = static_cast<int32>(PackedSource) - 1;
+        TargetSlot = static_cast<int32>(PackedTarget) - 1;
+        OtherInventory = bHasOtherInventory ? Cast<UInventoryComponent>(OtherObject) : nullptr;
+    }
+
+    return true;
 }
 
 int32 FItemStack::MaxStack() const
@@ -123,16 +519,24 @@ int32 UInventoryComponent::AddItem(UItemData* Item, int32 Count)
 
 int32 UInventoryComponent::AddToExistingStacks(UItemData* Item, int32 Count)
 {
+    const FInventoryItemSlotIndex* Entry = ItemSlotIndex.Find(Item);
+    if (!Entry)
+    {
+        return 0;
+    }
+
     int32 Added = 0;
     const int32 Max = FItemStack{ Item, 0 }.MaxStack();
-    for (FItemStack& Slot : Slots)
+    const TArray<int32, TInlineAllocator<4>> MatchingSlots = Entry->SlotIndices;
+    for (const int32 Index : MatchingSlots)
     {
         if (Count <= 0) break;
-        if (Slot.Item == Item && Slot.Quantity < Max)
+        const FItemStack& Slot = GetSlotContents(Index);
+        if (Slot.Quantity < Max)
         {
             const int32 Space = Max - Slot.Quantity;
             const int32 ToAdd = FMath::Min(Space, Count);
-            Slot.Quantity += ToAdd;
+            SetSlotContents(Index, Item, Slot.Quantity + ToAdd);
             Added += ToAdd;
             Count -= ToAdd;
         }
@@ -145,17 +549,12 @@ int32 UInventoryComponent::AddToEmptySlots(UItemData* Item, int32 Count)
     int32 Added = 0;
     EnsureSlotCapacity();
     const int32 Max = FItemStack{ Item, 0 }.MaxStack();
-    for (FItemStack& Slot : Slots)
+    for (int32 Index = FreeSlots.Find(true); Index != INDEX_NONE && Count > 0; Index = FreeSlots.FindFrom(true, Index + 1))
     {
-        if (Count <= 0) break;
-        if (Slot.IsEmpty())
-        {
-            Slot.Item = Item;
-            const int32 ToAdd = FMath::Min(Max, Count);
-            Slot.Quantity = ToAdd;
-            Added += ToAdd;
-            Count -= ToAdd;
-        }
+        const int32 ToAdd = FMath::Min(Max, Count);
+        SetSlotContents(Index, Item, ToAdd);
+        Added += ToAdd;
+        Count -= ToAdd;
     }
     return Added;
 }
@@ -169,20 +568,18 @@ int32 UInventoryComponent::RemoveItem(UItemData* Item, int32 Count)
     }
     EnsureSlotCapacity();
     int32 Removed = 0;
-    for (FItemStack& Slot : Slots)
+    if (const FInventoryItemSlotIndex* Entry = ItemSlotIndex.Find(Item))
     {
-        if (Count <= 0) break;
-        if (Slot.Item == Item)
+        // Copy the indices: emptied slots drop out of the index while we iterate.
+        const TArray<int32, TInlineAllocator<4>> MatchingSlots = Entry->SlotIndices;
+        for (const int32 Index : MatchingSlots)
         {
+            if (Count <= 0) break;
+            const FItemStack& Slot = GetSlotContents(Index);
             const int32 ToRemove = FMath::Min(Slot.Quantity, Count);
-            Slot.Quantity -= ToRemove;
+            SetSlotContents(Index, Item, Slot.Quantity - ToRemove);
             Removed += ToRemove;
             Count -= ToRemove;
-            if (Slot.Quantity <= 0)
-            {
-                Slot.Quantity = 0;
-                Slot.Item = nullptr;
-            }
         }
     }
     if (Removed > 0)
@@ -196,42 +593,79 @@ int32 UInventoryComponent::RemoveItem(UItemData* Item, int32 Count)
 int32 UInventoryComponent::CountItem(UItemData* Item) const
 {
     if (!Item) return 0;
-    int32 Total = 0;
-    for (const FItemStack& Slot : Slots)
+    const FInventoryItemSlotIndex* Entry = ItemSlotIndex.Find(Item);
+    return Entry ? Entry->TotalQuantity : 0;
+}
+
+bool UInventoryComponent::IsEmpty() const
+{
+    return ItemSlotIndex.Num() == 0;
+}
+
+void UInventoryComponent::GetSlotAtIndex(int32 SlotIndex, FItemStack& OutSlot) const
+{
+    if (IsValidSlotIndex(SlotIndex))
     {
-        if (Slot.Item == Item) { Total += Slot.Quantity; }
+        OutSlot = GetSlotContents(SlotIndex);
+        OutSlot.SlotIndex = SlotIndex;
+    }
+    else
+    {
+        OutSlot = FItemStack{};
     }
-    return Total;
 }
 
-bool UInventoryComponent::IsEmpty() const
+const TArray<FItemStack>& UInventoryComponent::GetSlots() const
 {
-    for (const FItemStack& Slot : Slots)
+    if (!UsesSparseStorage())
     {
-        if (!Slot.IsEmpty())
-        {
-            return false;
-        }
+        return SlotArray.Items;
     }
 
-    return true;
+    if (bMaterializedSlotsDirty)
+    {
+        GetSlotPage(0, SparseSlotCount, MaterializedSlots);
+        bMaterializedSlotsDirty = false;
+    }
+
+    return MaterializedSlots;
 }
 
-void UInventoryComponent::GetSlotAtIndex(int32 SlotIndex, FItemStack& OutSlot) const
+void UInventoryComponent::GetSlotPage(int32 FirstSlotIndex, int32 Count, TArray<FItemStack>& OutSlots) const
 {
-    if (Slots.IsValidIndex(SlotIndex))
+    OutSlots.Reset();
+
+    const int32 FirstSlot = FMath::Max(0, FirstSlotIndex);
+    const int32 EndSlot = static_cast<int32>(FMath::Min<int64>(GetNumSlots(), static_cast<int64>(FirstSlot) + FMath::Max(0, Count)));
+    if (EndSlot <= FirstSlot)
     {
-        OutSlot = Slots[SlotIndex];
+        return;
     }
-    else
+
+    OutSlots.Reserve(EndSlot - FirstSlot);
+    for (int32 SlotIndex = FirstSlot; SlotIndex < EndSlot; ++SlotIndex)
     {
-        OutSlot = FItemStack{};
+        FItemStack& Slot = OutSlots.Add_GetRef(GetSlotContents(SlotIndex));
+        Slot.SlotIndex = SlotIndex;
+    }
+}
+
+const FItemStack& UInventoryComponent::GetSlotContents(int32 SlotIndex) const
+{
+    static const FItemStack EmptySlot;
+
+    if (!UsesSparseStorage())
+    {
+        return SlotArray.Items.IsValidIndex(SlotIndex) ? SlotArray.Items[SlotIndex] : EmptySlot;
     }
+
+    const int32* ArrayIndex = SparseSlotLookup.Find(SlotIndex);
+    return ArrayIndex && SlotArray.Items.IsValidIndex(*ArrayIndex) ? SlotArray.Items[*ArrayIndex] : EmptySlot;
 }
 
 bool UInventoryComponent::DebugSetSlot(int32 SlotIndex, UItemData* Item, int32 Quantity)
 {
-    if (!Slots.IsValidIndex(SlotIndex) || Quantity < 0)
+    if (!IsValidSlotIndex(SlotIndex) || Quantity < 0)
     {
         return false;
     }
@@ -245,15 +679,7 @@ bool UInventoryComponent::DebugSetSlot(int32 SlotIndex, UItemData* Item, int32 Q
         }
     }
 
-    FItemStack& Slot = Slots[SlotIndex];
-    Slot.Item = Item;
-    Slot.Quantity = Quantity;
-
-    if (Slot.Quantity <= 0)
-    {
-        Slot.Quantity = 0;
-        Slot.Item = nullptr;
-    }
+    SetSlotContents(SlotIndex, Item, Quantity);
 
     MarkInventoryUpdateSource(EInventoryUpdateSource::PlayerAction);
     BroadcastInventoryChanged();
@@ -264,8 +690,16 @@ bool UInventoryComponent::SplitStackAtIndex(int32 SlotIndex)
 {
     if (AActor* OwnerActor = GetOwner())
     {
-        if (OwnerActor->GetLocalRole() != ROLE_Authority)
+        if (OwnerActor->GetLocalRole() != ROLE_Authority && !bApplyingPrediction)
         {
+            if (CanPredictCommands())
+            {
+                FInventoryCommand Command;
+                Command.Type = EInventoryCommandType::Split;
+                Command.SourceSlot = SlotIndex;
+                return PredictCommand(Command);
+            }
+
             ServerSplitStackAtIndex(SlotIndex);
             return false;
         }
@@ -273,12 +707,12 @@ bool UInventoryComponent::SplitStackAtIndex(int32 SlotIndex)
 
     EnsureSlotCapacity();
 
-    if (!Slots.IsValidIndex(SlotIndex))
+    if (!IsValidSlotIndex(SlotIndex))
     {
         return false;
     }
 
-    FItemStack& Slot = Slots[SlotIndex];
+    const FItemStack Slot = GetSlotContents(SlotIndex);
     if (Slot.IsEmpty() || Slot.Quantity <= 1)
     {
         return false;
@@ -290,13 +724,13 @@ bool UInventoryComponent::SplitStackAtIndex(int32 SlotIndex)
         return false;
     }
 
-    const int32 OriginalQuantity = Slot.Quantity;
-    Slot.Quantity -= AmountToMove;
+    FInventoryTransaction Transaction(this);
+    SetSlotContents(SlotIndex, Slot.Item, Slot.Quantity - AmountToMove);
 
     const int32 Added = AddToEmptySlots(Slot.Item, AmountToMove);
     if (Added != AmountToMove)
     {
-        Slot.Quantity = OriginalQuantity;
+        SetSlotContents(SlotIndex, Slot.Item, Slot.Quantity - Added);
         return false;
     }
 
@@ -318,19 +752,17 @@ bool UInventoryComponent::DestroyItemAtIndex(int32 SlotIndex)
 
     EnsureSlotCapacity();
 
-    if (!Slots.IsValidIndex(SlotIndex))
+    if (!IsValidSlotIndex(SlotIndex))
     {
         return false;
     }
 
-    FItemStack& Slot = Slots[SlotIndex];
-    if (Slot.IsEmpty())
+    if (GetSlotContents(SlotIndex).IsEmpty())
     {
         return false;
     }
 
-    Slot.Item = nullptr;
-    Slot.Quantity = 0;
+    SetSlotContents(SlotIndex, nullptr, 0);
 
     MarkInventoryUpdateSource(EInventoryUpdateSource::PlayerAction);
     BroadcastInventoryChanged();
@@ -353,6 +785,13 @@ bool UInventoryComponent::DropItemAtIndex(int32 SlotIndex)
         return true;
     }
 
+    EnsureSlotCapacity();
+
+    if (DropMode == EInventoryDropMode::Stacked && IsValidSlotIndex(SlotIndex) && GetSlotContents(SlotIndex).Quantity > 1)
+    {
+        return DropStackInternal(SlotIndex);
+    }
+
     if (!DropSingleItemInternal(SlotIndex))
     {
         return false;
@@ -360,7 +799,7 @@ bool UInventoryComponent::DropItemAtIndex(int32 SlotIndex)
 
     EnsureSlotCapacity();
 
-    if (!Slots.IsValidIndex(SlotIndex) || Slots[SlotIndex].IsEmpty())
+    if (!IsValidSlotIndex(SlotIndex) || GetSlotContents(SlotIndex).IsEmpty())
     {
         return true;
     }
@@ -418,18 +857,18 @@ bool UInventoryComponent::TransferItemToInventory(UInventoryComponent* TargetInv
     EnsureSlotCapacity();
     TargetInventory->EnsureSlotCapacity();
 
-    if (!Slots.IsValidIndex(SourceSlotIndex) || !TargetInventory->Slots.IsValidIndex(TargetSlotIndex))
+    if (!IsValidSlotIndex(SourceSlotIndex) || !TargetInventory->IsValidSlotIndex(TargetSlotIndex))
     {
         return false;
     }
 
-    FItemStack& SourceSlot = Slots[SourceSlotIndex];
+    const FItemStack SourceSlot = GetSlotContents(SourceSlotIndex);
     if (SourceSlot.IsEmpty())
     {
         return false;
     }
 
-    FItemStack& TargetSlot = TargetInventory->Slots[TargetSlotIndex];
+    const FItemStack TargetSlot = TargetInventory->GetSlotContents(TargetSlotIndex);
 
     const UItemData* SourceItem = SourceSlot.Item;
     if (!SourceItem)
@@ -449,15 +888,8 @@ bool UInventoryComponent::TransferItemToInventory(UInventoryComponent* TargetInv
             return false;
         }
 
-        TargetSlot.Item = SourceSlot.Item;
-        TargetSlot.Quantity = TransferAmount;
-
-        SourceSlot.Quantity -= TransferAmount;
-        if (SourceSlot.Quantity <= 0)
-        {
-            SourceSlot.Item = nullptr;
-            SourceSlot.Quantity = 0;
-        }
+        TargetInventory->SetSlotContents(TargetSlotIndex, SourceSlot.Item, TransferAmount);
+        SetSlotContents(SourceSlotIndex, SourceSlot.Item, SourceSlot.Quantity - TransferAmount);
 
         bChangedSource = true;
         bChangedTarget = true;
@@ -477,21 +909,16 @@ bool UInventoryComponent::TransferItemToInventory(UInventoryComponent* TargetInv
             return false;
         }
 
-        TargetSlot.Quantity += TransferAmount;
-        SourceSlot.Quantity -= TransferAmount;
-
-        if (SourceSlot.Quantity <= 0)
-        {
-            SourceSlot.Item = nullptr;
-            SourceSlot.Quantity = 0;
-        }
+        TargetInventory->SetSlotContents(TargetSlotIndex, TargetSlot.Item, TargetSlot.Quantity + TransferAmount);
+        SetSlotContents(SourceSlotIndex, SourceSlot.Item, SourceSlot.Quantity - TransferAmount);
 
         bChangedSource = true;
         bChangedTarget = true;
     }
     else
     {
-        Swap(TargetSlot, SourceSlot);
+        TargetInventory->SetSlotContents(TargetSlotIndex, SourceSlot.Item, SourceSlot.Quantity);
+        SetSlotContents(SourceSlotIndex, TargetSlot.Item, TargetSlot.Quantity);
         bChangedSource = true;
         bChangedTarget = true;
     }
@@ -511,142 +938,548 @@ bool UInventoryComponent::TransferItemToInventory(UInventoryComponent* TargetInv
     return true;
 }
 
-namespace
+bool UInventoryComponent::SortSlots()
+{
+    if (AActor* OwnerActor = GetOwner())
+    {
+        if (OwnerActor->GetLocalRole() != ROLE_Authority)
+        {
+            ServerSortSlots();
+            return false;
+        }
+    }
+
+    EnsureSlotCapacity();
+
+    struct FSortedItem
+    {
+        UItemData* Item = nullptr;
+        FString SortKey;
+        int32 Quantity = 0;
+    };
+
+    TArray<FSortedItem> SortedItems;
+    SortedItems.Reserve(ItemSlotIndex.Num());
+    for (const TPair<const UItemData*, FInventoryItemSlotIndex>& Pair : ItemSlotIndex)
+    {
+        FSortedItem& Entry = SortedItems.AddDefaulted_GetRef();
+        Entry.Item = GetSlotContents(Pair.Value.SlotIndices[0]).Item;
+        Entry.SortKey = Entry.Item->DisplayName.IsEmpty() ? Entry.Item->GetName() : Entry.Item->DisplayName.ToString();
+        Entry.Quantity = Pair.Value.TotalQuantity;
+    }
+
+    SortedItems.Sort([](const FSortedItem& A, const FSortedItem& B)
+    {
+        const int32 Compare = A.SortKey.Compare(B.SortKey, ESearchCase::IgnoreCase);
+        return Compare != 0 ? Compare < 0 : A.Item->GetFName().LexicalLess(B.Item->GetFName());
+    });
+
+    TArray<FItemStack> Layout;
+    Layout.Reserve(SortedItems.Num());
+    for (const FSortedItem& Entry : SortedItems)
+    {
+        const int32 MaxStack = FItemStack{ Entry.Item, 0 }.MaxStack();
+        for (int32 Remaining = Entry.Quantity; Remaining > 0; Remaining -= MaxStack)
+        {
+            Layout.Emplace(Entry.Item, FMath::Min(Remaining, MaxStack));
+        }
+    }
+
+    // Only possible if an item's MaxStackSize shrank after it was stored.
+    if (Layout.Num() > GetNumSlots())
+    {
+        return false;
+    }
+
+    // Slots past the packed layout only need visiting if they currently hold something.
+    TArray<int32> SlotsToClear;
+    for (const TPair<const UItemData*, FInventoryItemSlotIndex>& Pair : ItemSlotIndex)
+    {
+        for (const int32 Index : Pair.Value.SlotIndices)
+        {
+            if (Index >= Layout.Num())
+            {
+                SlotsToClear.Add(Index);
+            }
+        }
+    }
+
+    FInventoryTransaction Transaction(this);
+    bool bChanged = false;
+    for (int32 Index = 0; Index < Layout.Num(); ++Index)
+    {
+        const FItemStack& Desired = Layout[Index];
+        const FItemStack& Current = GetSlotContents(Index);
+        if (Current.Item != Desired.Item || Current.Quantity != Desired.Quantity)
+        {
+            SetSlotContents(Index, Desired.Item, Desired.Quantity);
+            bChanged = true;
+        }
+    }
+
+    for (const int32 Index : SlotsToClear)
+    {
+        SetSlotContents(Index, nullptr, 0);
+        bChanged = true;
+    }
+
+    if (bChanged)
+    {
+        MarkInventoryUpdateSource(EInventoryUpdateSource::PlayerAction);
+        BroadcastInventoryChanged();
+    }
+
+    return bChanged;
+}
+
+int32 UInventoryComponent::TakeAllFromInventory(UInventoryComponent* SourceInventory)
+{
+    if (!SourceInventory || SourceInventory == this)
+    {
+        return 0;
+    }
+
+    if (AActor* OwnerActor = GetOwner())
+    {
+        if (OwnerActor->GetLocalRole() != ROLE_Authority)
+        {
+            ServerTakeAllFromInventory(SourceInventory);
+            return 0;
+        }
+    }
+
+    EnsureSlotCapacity();
+    SourceInventory->EnsureSlotCapacity();
+
+    TArray<int32> OccupiedSlots;
+    for (const TPair<const UItemData*, FInventoryItemSlotIndex>& Pair : SourceInventory->ItemSlotIndex)
+    {
+        OccupiedSlots.Append(Pair.Value.SlotIndices);
+    }
+    OccupiedSlots.Sort();
+
+    FInventoryTransaction TargetTransaction(this);
+    FInventoryTransaction SourceTransaction(SourceInventory);
+
+    int32 Moved = 0;
+    for (const int32 Index : OccupiedSlots)
+    {
+        const FItemStack Slot = SourceInventory->GetSlotContents(Index);
+        int32 Added = AddToExistingStacks(Slot.Item, Slot.Quantity);
+        Added += AddToEmptySlots(Slot.Item, Slot.Quantity - Added);
+        if (Added > 0)
+        {
+            SourceInventory->SetSlotContents(Index, Slot.Item, Slot.Quantity - Added);
+            Moved += Added;
+        }
+    }
+
+    if (Moved > 0)
+    {
+        MarkInventoryUpdateSource(EInventoryUpdateSource::PlayerAction);
+        BroadcastInventoryChanged();
+        SourceInventory->MarkInventoryUpdateSource(EInventoryUpdateSource::PlayerAction);
+        SourceInventory->BroadcastInventoryChanged();
+    }
+
+    return Moved;
+}
+
+int32 UInventoryComponent::SubmitCommands(const TArray<FInventoryCommand>& Commands)
+{
+    const int32 Sequence = ++NextCommandSequence;
+
+    if (AActor* OwnerActor = GetOwner())
+    {
+        if (OwnerActor->GetLocalRole() != ROLE_Authority)
+        {
+            ServerExecuteCommands(Commands, Sequence);
+            return Sequence;
+        }
+    }
+
+    const bool bSucceeded = ApplyCommandBatch(Commands);
+    OnCommandsAcknowledged.Broadcast(Sequence, bSucceeded);
+    return Sequence;
+}
+
+bool UInventoryComponent::ApplyCommandBatch(const TArray<FInventoryCommand>& Commands)
+{
+    if (Commands.Num() == 0 || Commands.Num() > MaxCommandsPerBatch)
+    {
+        return false;
+    }
+
+    EnsureSlotCapacity();
+
+    TArray<UInventoryComponent*, TInlineAllocator<4>> Involved;
+    Involved.Add(this);
+    for (const FInventoryCommand& Command : Commands)
+    {
+        if (Command.OtherInventory)
+        {
+            Involved.AddUnique(Command.OtherInventory);
+        }
+    }
+
+    for (UInventoryComponent* Inventory : Involved)
+    {
+        Inventory->BeginTransaction();
+        Inventory->bRecordingUndo = true;
+    }
+
+    // Pickups are only spawned once the whole batch has succeeded so a rejected batch leaves no trace.
+    TArray<FItemStack> PendingDrops;
+    bool bSucceeded = true;
+    for (const FInventoryCommand& Command : Commands)
+    {
+        if (!ApplyCommand(Command, PendingDrops))
+        {
+            bSucceeded = false;
+            break;
+        }
+    }
+
+    for (UInventoryComponent* Inventory : Involved)
+    {
+        Inventory->bRecordingUndo = false;
+        if (!bSucceeded)
+        {
+            Inventory->RollbackUndoSlots();
+        }
+
+        Inventory->UndoSlots.Reset();
+        Inventory->CommitTransaction();
+    }
+
+    if (!bSucceeded)
+    {
+        UE_LOG(LogMOInventoryComponent, Verbose, TEXT("Rejected inventory command batch of %d on %s"), Commands.Num(), *GetNameSafe(GetOwner()));
+        return false;
+    }
+
+    for (const FItemStack& Drop : PendingDrops)
+    {
+        if (!SpawnDroppedPickup(Drop.Item, Drop.Quantity))
+        {
+            AddItem(Drop.Item, Drop.Quantity);
+        }
+    }
+
+    return true;
+}
+
+bool UInventoryComponent::ApplyCommand(const FInventoryCommand& Command, TArray<FItemStack>& OutPendingDrops)
+{
+    switch (Command.Type)
+    {
+    case EInventoryCommandType::Move:
+        return TransferItemBetweenSlots(Command.SourceSlot, Command.TargetSlot);
+
+    case EInventoryCommandType::Split:
+        return SplitStackAtIndex(Command.SourceSlot);
+
+    case EInventoryCommandType::Merge:
+        if (!IsValidSlotIndex(Command.SourceSlot) || !IsValidSlotIndex(Command.TargetSlot)
+            || GetSlotContents(Command.SourceSlot).IsEmpty()
+            || GetSlotContents(Command.SourceSlot).Item != GetSlotContents(Command.TargetSlot).Item)
+        {
+            return false;
+        }
+        return TransferItemBetweenSlots(Command.SourceSlot, Command.TargetSlot);
+
+    case EInventoryCommandType::Drop:
+    {
+        if (!IsValidSlotIndex(Command.SourceSlot) || GetSlotContents(Command.SourceSlot).IsEmpty()
+            || ActiveDropAllTimers.Contains(Command.SourceSlot))
+        {
+            return false;
+        }
+
+        const FItemStack& Slot = GetSlotContents(Command.SourceSlot);
+        OutPendingDrops.Emplace(Slot.Item, Slot.Quantity);
+        SetSlotContents(Command.SourceSlot, nullptr, 0);
+        MarkInventoryUpdateSource(EInventoryUpdateSource::PlayerAction);
+        BroadcastInventoryChanged();
+        return true;
+    }
+
+    case EInventoryCommandType::TransferToInventory:
+        return TransferItemToInventory(Command.OtherInventory, Command.SourceSlot, Command.TargetSlot);
+
+    case EInventoryCommandType::TakeAll:
+        // Access to OtherInventory is checked for the whole batch before it runs. Taking nothing (another player
+        // emptied the source first, or nothing fits) is a valid no-op and must not roll back the rest of the batch.
+        if (!Command.OtherInventory || Command.OtherInventory == this)
+        {
+            return false;
+        }
+
+        TakeAllFromInventory(Command.OtherInventory);
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+void UInventoryComponent::RollbackUndoSlots()
+{
+    for (const TPair<int32, FItemStack>& Pair : UndoSlots)
+    {
+        SetSlotContents(Pair.Key, Pair.Value.Item, Pair.Value.Quantity);
+    }
+
+    MarkInventoryUpdateSource(EInventoryUpdateSource::PlayerAction);
+    BroadcastInventoryChanged();
+}
+
+float UInventoryComponent::GetTotalWeight() const
+{
+    return static_cast<float>(TotalWeight);
+}
+
+float UInventoryComponent::GetTotalVolume() const
+{
+    return static_cast<float>(TotalVolume);
+}
+
+void UInventoryComponent::SetSlotContents(int32 SlotIndex, UItemData* Item, int32 Quantity)
+{
+    check(IsValidSlotIndex(SlotIndex));
+
+    if (UsesSparseStorage())
+    {
+        SetSparseSlotContents(SlotIndex, Item, Quantity);
+        return;
+    }
+
+    FItemStack& Slot = SlotArray.Items[SlotIndex];
+    if (bApplyingPrediction)
+    {
+        PredictedSlots.Add(SlotIndex);
+    }
+
+    if (bRecordingUndo && !UndoSlots.Contains(SlotIndex))
+    {
+        UndoSlots.Add(SlotIndex, FItemStack(Slot.Item, Slot.Quantity));
+    }
+
+    RemoveSlotFromCaches(SlotIndex, Slot);
+
+    Slot.Item = Quantity > 0 ? Item : nullptr;
+    Slot.Quantity = Slot.Item ? Quantity : 0;
+
+    AddSlotToCaches(SlotIndex, Slot);
+    PendingChangedSlots.Add(SlotIndex);
+
+    if (HasSlotAuthority())
+    {
+        SlotArray.MarkItemDirty(Slot);
+    }
+}
+
+void UInventoryComponent::SetSparseSlotContents(int32 SlotIndex, UItemData* Item, int32 Quantity)
 {
-    constexpr float KgToLbs = 2.20462262f;
-    constexpr float Cm3ToM3 = 1.0e-6f;
+    const FItemStack Previous = GetSlotContents(SlotIndex);
+    if (bRecordingUndo && !UndoSlots.Contains(SlotIndex))
+    {
+        UndoSlots.Add(SlotIndex, FItemStack(Previous.Item, Previous.Quantity));
+    }
+
+    RemoveSlotFromCaches(SlotIndex, Previous);
 
-    float ResolveItemWeightKg(const UItemData* Item)
+    FItemStack NewContents(Quantity > 0 ? Item : nullptr, 0);
+    NewContents.Quantity = NewContents.Item ? Quantity : 0;
+    NewContents.SlotIndex = SlotIndex;
+
+    const bool bAuthority = HasSlotAuthority();
+    if (const int32* ExistingIndex = SparseSlotLookup.Find(SlotIndex))
     {
-        if (!Item)
+        const int32 ArrayIndex = *ExistingIndex;
+        if (NewContents.IsEmpty())
         {
-            return 0.f;
-        }
+            // Emptied slots leave the array entirely; the entry swapped into the hole keeps its lookup valid.
+            SparseSlotLookup.Remove(SlotIndex);
+            SlotArray.Items.RemoveAtSwap(ArrayIndex, 1, EAllowShrinking::No);
+            if (SlotArray.Items.IsValidIndex(ArrayIndex))
+            {
+                SparseSlotLookup.Add(SlotArray.Items[ArrayIndex].SlotIndex, ArrayIndex);
+            }
 
-        if (Item->WeightKgOverride > 0.f)
-        {
-            return Item->WeightKgOverride;
+            if (bAuthority)
+            {
+                SlotArray.MarkArrayDirty();
+            }
         }
-
-        if (Item->WeightLbsOverride > 0.f)
+        else
         {
-            return Item->WeightLbsOverride / KgToLbs;
-        }
+            FItemStack& Slot = SlotArray.Items[ArrayIndex];
+            Slot.Item = NewContents.Item;
+            Slot.Quantity = NewContents.Quantity;
 
-        if (UStaticMesh* StaticMesh = Item->WorldStaticMesh.LoadSynchronous())
-        {
-            if (UBodySetup* BodySetup = StaticMesh->GetBodySetup())
+            if (bAuthority)
             {
-                float Mass = BodySetup->CalculateMass();
-                const float ScaleFactor = FMath::Abs(Item->WorldScale3D.X * Item->WorldScale3D.Y * Item->WorldScale3D.Z);
-                if (ScaleFactor > KINDA_SMALL_NUMBER)
-                {
-                    Mass *= ScaleFactor;
-                }
-
-                if (Mass > KINDA_SMALL_NUMBER)
-                {
-                    return Mass;
-                }
+                SlotArray.MarkItemDirty(Slot);
             }
         }
+    }
+    else if (!NewContents.IsEmpty())
+    {
+        FItemStack& Slot = SlotArray.Items.Add_GetRef(NewContents);
+        SparseSlotLookup.Add(SlotIndex, SlotArray.Items.Num() - 1);
 
-        if (USkeletalMesh* SkeletalMesh = Item->WorldSkeletalMesh.LoadSynchronous())
+        if (bAuthority)
         {
-            if (UPhysicsAsset* PhysicsAsset = SkeletalMesh->GetPhysicsAsset())
-            {
-                float Mass = 0.f;
-                for (USkeletalBodySetup* BodySetup : PhysicsAsset->SkeletalBodySetups)
-                {
-                    if (BodySetup)
-                    {
-                        Mass += BodySetup->CalculateMass();
-                    }
-                }
-
-                if (Mass > KINDA_SMALL_NUMBER)
-                {
-                    return Mass;
-                }
-            }
+            SlotArray.MarkItemDirty(Slot);
         }
+    }
+
+    AddSlotToCaches(SlotIndex, NewContents);
+    PendingChangedSlots.Add(SlotIndex);
+    bMaterializedSlotsDirty = true;
+}
+
+bool UInventoryComponent::HasSlotAuthority() const
+{
+    const AActor* OwnerActor = GetOwner();
+    return !OwnerActor || OwnerActor->HasAuthority();
+}
 
-        return 0.f;
+void UInventoryComponent::RemoveSlotFromCaches(int32 SlotIndex, const FItemStack& Slot)
+{
+    if (Slot.IsEmpty())
+    {
+        return;
     }
 
-    float ResolveItemVolumeM3(const UItemData* Item)
+    // Subtract what was added for this item, not what it reads as now, so a changed value cannot leave a residue.
+    if (FInventoryItemSlotIndex* Entry = ItemSlotIndex.Find(Slot.Item))
     {
-        if (!Item)
-        {
-            return 0.f;
-        }
+        TotalWeight -= Entry->UnitWeightKg * Slot.Quantity;
+        TotalVolume -= Entry->UnitVolumeM3 * Slot.Quantity;
 
-        if (Item->VolumeOverride > 0.f)
+        Entry->SlotIndices.RemoveSingle(SlotIndex);
+        Entry->TotalQuantity -= Slot.Quantity;
+        if (Entry->SlotIndices.Num() == 0)
         {
-            return Item->VolumeOverride;
+            ItemSlotIndex.Remove(Slot.Item);
         }
+    }
 
-        float VolumeCm3 = 0.f;
+    if (FreeSlots.IsValidIndex(SlotIndex))
+    {
+        FreeSlots[SlotIndex] = true;
+    }
+}
 
-        if (UStaticMesh* StaticMesh = Item->WorldStaticMesh.LoadSynchronous())
-        {
-            if (UBodySetup* BodySetup = StaticMesh->GetBodySetup())
-            {
-                VolumeCm3 = BodySetup->AggGeom.GetScaledVolume(Item->WorldScale3D);
-            }
+void UInventoryComponent::AddSlotToCaches(int32 SlotIndex, const FItemStack& Slot)
+{
+    if (FreeSlots.Num() <= SlotIndex)
+    {
+        FreeSlots.Add(true, SlotIndex + 1 - FreeSlots.Num());
+    }
 
-            if (VolumeCm3 <= 0.f)
-            {
-                const FBoxSphereBounds Bounds = StaticMesh->GetBounds();
-                const FVector Extents = Bounds.BoxExtent * Item->WorldScale3D * 2.f;
-                VolumeCm3 = Extents.X * Extents.Y * Extents.Z;
-            }
-        }
+    if (Slot.IsEmpty())
+    {
+        FreeSlots[SlotIndex] = true;
+        return;
+    }
 
-        if (VolumeCm3 <= 0.f)
+    FreeSlots[SlotIndex] = false;
+
+    FInventoryItemSlotIndex* Entry = ItemSlotIndex.Find(Slot.Item);
+    if (!Entry)
+    {
+        // The first stack of an item fixes its per-unit values until the last stack leaves.
+        const FItemPhysicalProperties Properties = Slot.Item->GetPhysicalProperties();
+        Entry = &ItemSlotIndex.Add(Slot.Item);
+        Entry->UnitWeightKg = Properties.WeightKg;
+        Entry->UnitVolumeM3 = Properties.VolumeM3;
+    }
+
+    TotalWeight += Entry->UnitWeightKg * Slot.Quantity;
+    TotalVolume += Entry->UnitVolumeM3 * Slot.Quantity;
+
+    // Keep indices sorted so stacking and removal visit slots in the same order as a linear scan.
+    Entry->SlotIndices.Insert(SlotIndex, Algo::LowerBound(Entry->SlotIndices, SlotIndex));
+    Entry->TotalQuantity += Slot.Quantity;
+}
+
+void UInventoryComponent::RebuildSlotCaches()
+{
+    TotalWeight = 0.0;
+    TotalVolume = 0.0;
+    ItemSlotIndex.Reset();
+    FreeSlots.Init(true, GetNumSlots());
+
+    if (UsesSparseStorage())
+    {
+        for (const FItemStack& Slot : SlotArray.Items)
         {
-            if (USkeletalMesh* SkeletalMesh = Item->WorldSkeletalMesh.LoadSynchronous())
+            if (Slot.SlotIndex >= 0)
             {
-                const FBoxSphereBounds Bounds = SkeletalMesh->GetBounds();
-                const FVector Extents = Bounds.BoxExtent * Item->WorldScale3D * 2.f;
-                VolumeCm3 = Extents.X * Extents.Y * Extents.Z;
+                AddSlotToCaches(Slot.SlotIndex, Slot);
             }
         }
 
-        return FMath::Max(0.f, VolumeCm3) * Cm3ToM3;
+        return;
     }
-}
 
-float UInventoryComponent::GetTotalWeight() const
-{
-    double TotalWeight = 0.0;
-    for (const FItemStack& Slot : Slots)
+    for (int32 Index = 0; Index < SlotArray.Items.Num(); ++Index)
     {
-        if (!Slot.Item || Slot.Quantity <= 0)
+        FItemStack& Slot = SlotArray.Items[Index];
+        if (HasSlotAuthority())
         {
-            continue;
+            // Slots serialized before SlotIndex existed load as INDEX_NONE.
+            Slot.SlotIndex = Index;
         }
 
-        TotalWeight += static_cast<double>(ResolveItemWeightKg(Slot.Item)) * Slot.Quantity;
+        AddSlotToCaches(Index, Slot);
     }
-
-    return static_cast<float>(TotalWeight);
 }
 
-float UInventoryComponent::GetTotalVolume() const
+void UInventoryComponent::ValidateSlotCaches()
 {
-    double TotalVolume = 0.0;
-    for (const FItemStack& Slot : Slots)
+#if !UE_BUILD_SHIPPING
+    if (CVarValidateInventoryTotals.GetValueOnGameThread() == 0)
+    {
+        return;
+    }
+
+    // Recompute from the stored slots into locals; the live caches are only read, so drift stays visible.
+    double ExpectedWeight = 0.0;
+    double ExpectedVolume = 0.0;
+    TMap<const UItemData*, int32> ExpectedQuantities;
+    for (int32 Index = 0; Index < SlotArray.Items.Num(); ++Index)
     {
-        if (!Slot.Item || Slot.Quantity <= 0)
+        const FItemStack& Slot = SlotArray.Items[Index];
+        const int32 SlotIndex = UsesSparseStorage() ? Slot.SlotIndex : Index;
+        if (Slot.IsEmpty() || SlotIndex < 0)
         {
             continue;
         }
 
-        TotalVolume += static_cast<double>(ResolveItemVolumeM3(Slot.Item)) * Slot.Quantity;
+        const FItemPhysicalProperties Properties = Slot.Item->GetPhysicalProperties();
+        ExpectedWeight += static_cast<double>(Properties.WeightKg) * Slot.Quantity;
+        ExpectedVolume += static_cast<double>(Properties.VolumeM3) * Slot.Quantity;
+        ExpectedQuantities.FindOrAdd(Slot.Item) += Slot.Quantity;
     }
 
-    return static_cast<float>(TotalVolume);
+    constexpr double Tolerance = 1.0e-3;
+    ensureMsgf(FMath::IsNearlyEqual(TotalWeight, ExpectedWeight, Tolerance) && FMath::IsNearlyEqual(TotalVolume, ExpectedVolume, Tolerance),
+        TEXT("Inventory totals drifted on %s: Weight %.4f (expected %.4f) Volume %.6f (expected %.6f)"),
+        *GetNameSafe(GetOwner()), TotalWeight, ExpectedWeight, TotalVolume, ExpectedVolume);
+
+    bool bIndexMatches = ExpectedQuantities.Num() == ItemSlotIndex.Num();
+    for (const TPair<const UItemData*, FInventoryItemSlotIndex>& Pair : ItemSlotIndex)
+    {
+        const int32* ExpectedQuantity = ExpectedQuantities.Find(Pair.Key);
+        bIndexMatches &= ExpectedQuantity && *ExpectedQuantity == Pair.Value.TotalQuantity;
+    }
+
+    ensureMsgf(bIndexMatches, TEXT("Inventory item index drifted on %s"), *GetNameSafe(GetOwner()));
+#endif
 }
 
 void UInventoryComponent::EnsurePersistentId()
@@ -676,19 +1509,25 @@ void UInventoryComponent::WriteToSaveData(FInventorySaveData& OutData) const
     OutData.MaxWeight = MaxWeight;
     OutData.MaxVolume = MaxVolume;
 
-    OutData.Slots.SetNum(Slots.Num());
-    for (int32 Index = 0; Index < Slots.Num(); ++Index)
+    // Only occupied slots are written; each entry carries the slot it is restored into.
+    OutData.Slots.Reset();
+    for (int32 Index = 0; Index < SlotArray.Items.Num(); ++Index)
     {
-        const FItemStack& SourceSlot = Slots[Index];
-        FInventorySlotSaveData& SaveSlot = OutData.Slots[Index];
-
-        SaveSlot.ItemPath.Reset();
-        SaveSlot.Quantity = FMath::Max(0, SourceSlot.Quantity);
-
-        if (SourceSlot.Item)
+        const FItemStack& SourceSlot = SlotArray.Items[Index];
+        if (SourceSlot.IsEmpty())
         {
-            SaveSlot.ItemPath = FSoftObjectPath(SourceSlot.Item.Get());
+            continue;
         }
+
+        FInventorySlotSaveData& SaveSlot = OutData.Slots.AddDefaulted_GetRef();
+        SaveSlot.ItemPath = FSoftObjectPath(SourceSlot.Item.Get());
+        SaveSlot.Quantity = SourceSlot.Quantity;
+        SaveSlot.SlotIndex = UsesSparseStorage() ? SourceSlot.SlotIndex : Index;
+    }
+
+    if (UsesSparseStorage())
+    {
+        OutData.Slots.Sort([](const FInventorySlotSaveData& A, const FInventorySlotSaveData& B) { return A.SlotIndex < B.SlotIndex; });
     }
 }
 
@@ -705,19 +1544,29 @@ void UInventoryComponent::ReadFromSaveData(const FInventorySaveData& InData)
         InData.OwnerCharacterId.IsValid() ? *InData.OwnerCharacterId.ToString() : TEXT("None"),
         InData.Slots.Num());
 
-    const int32 SlotCount = Slots.Num();
-    for (int32 Index = 0; Index < SlotCount; ++Index)
+    TArray<int32> OccupiedSlots;
+    for (const TPair<const UItemData*, FInventoryItemSlotIndex>& Pair : ItemSlotIndex)
     {
-        FItemStack& TargetSlot = Slots[Index];
-        if (InData.Slots.IsValidIndex(Index))
-        {
-            ResolveItemIntoSlot(InData.Slots[Index], TargetSlot);
-        }
-        else
+        OccupiedSlots.Append(Pair.Value.SlotIndices);
+    }
+
+    for (const int32 Index : OccupiedSlots)
+    {
+        SetSlotContents(Index, nullptr, 0);
+    }
+
+    for (int32 EntryIndex = 0; EntryIndex < InData.Slots.Num(); ++EntryIndex)
+    {
+        const FInventorySlotSaveData& SlotData = InData.Slots[EntryIndex];
+        const int32 SlotIndex = SlotData.SlotIndex != INDEX_NONE ? SlotData.SlotIndex : EntryIndex;
+        if (!IsValidSlotIndex(SlotIndex))
         {
-            TargetSlot.Item = nullptr;
-            TargetSlot.Quantity = 0;
+            continue;
         }
+
+        FItemStack ResolvedSlot;
+        ResolveItemIntoSlot(SlotData, ResolvedSlot);
+        SetSlotContents(SlotIndex, ResolvedSlot.Item, ResolvedSlot.Quantity);
     }
 
     MarkInventoryUpdateSource(EInventoryUpdateSource::SaveApply);
@@ -755,35 +1604,68 @@ bool UInventoryComponent::DropSingleItemInternal(int32 SlotIndex)
 {
     EnsureSlotCapacity();
 
-    if (!Slots.IsValidIndex(SlotIndex))
+    if (!IsValidSlotIndex(SlotIndex))
     {
         return false;
     }
 
-    FItemStack& Slot = Slots[SlotIndex];
+    const FItemStack& Slot = GetSlotContents(SlotIndex);
     if (Slot.IsEmpty())
     {
         return false;
     }
 
-    UWorld* World = GetWorld();
-    AActor* OwnerActor = GetOwner();
-    if (!World || !OwnerActor)
+    UItemData* ItemData = Slot.Item;
+    if (!SpawnDroppedPickup(ItemData, 1))
     {
         return false;
     }
 
-    if (OwnerActor->GetLocalRole() != ROLE_Authority)
+    SetSlotContents(SlotIndex, ItemData, Slot.Quantity - 1);
+
+    MarkInventoryUpdateSource(EInventoryUpdateSource::PlayerAction);
+    BroadcastInventoryChanged();
+    return true;
+}
+
+bool UInventoryComponent::DropStackInternal(int32 SlotIndex)
+{
+    if (!IsValidSlotIndex(SlotIndex))
     {
         return false;
     }
 
-    UItemData* ItemData = Slot.Item;
-    if (!ItemData)
+    const FItemStack Slot = GetSlotContents(SlotIndex);
+    if (Slot.IsEmpty())
+    {
+        return false;
+    }
+
+    if (!SpawnDroppedPickup(Slot.Item, Slot.Quantity))
     {
         return false;
     }
 
+    SetSlotContents(SlotIndex, nullptr, 0);
+    MarkInventoryUpdateSource(EInventoryUpdateSource::PlayerAction);
+    BroadcastInventoryChanged();
+    return true;
+}
+
+AItemPickup* UInventoryComponent::SpawnDroppedPickup(UItemData* ItemData, int32 Quantity)
+{
+    UWorld* World = GetWorld();
+    AActor* OwnerActor = GetOwner();
+    if (!World || !OwnerActor || !ItemData || Quantity <= 0)
+    {
+        return nullptr;
+    }
+
+    if (OwnerActor->GetLocalRole() != ROLE_Authority)
+    {
+        return nullptr;
+    }
+
     UClass* PickupClass = nullptr;
     if (!ItemData->PickupActorClass.IsNull())
     {
@@ -811,34 +1693,35 @@ bool UInventoryComponent::DropSingleItemInternal(int32 SlotIndex)
     SpawnLocation += FVector(RandomCircle.X, RandomCircle.Y, 0.f);
     const FRotator SpawnRotation = OwnerActor->GetActorRotation();
 
-    FActorSpawnParameters SpawnParams;
-    SpawnParams.Owner = OwnerActor;
-    SpawnParams.Instigator = OwnerActor->GetInstigator();
-    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+    AItemPickup* SpawnedPickup = nullptr;
+    const FTransform SpawnTransform(SpawnRotation, SpawnLocation);
+    if (UItemPickupPoolSubsystem* Pool = World->GetSubsystem<UItemPickupPoolSubsystem>())
+    {
+        SpawnedPickup = Pool->AcquirePickup(PickupClass, SpawnTransform, OwnerActor, OwnerActor->GetInstigator());
+    }
+    else
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.Owner = OwnerActor;
+        SpawnParams.Instigator = OwnerActor->GetInstigator();
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+        SpawnedPickup = World->SpawnActor<AItemPickup>(PickupClass, SpawnLocation, SpawnRotation, SpawnParams);
+    }
 
-    AItemPickup* SpawnedPickup = World->SpawnActor<AItemPickup>(PickupClass, SpawnLocation, SpawnRotation, SpawnParams);
     if (!SpawnedPickup)
     {
-        return false;
+        return nullptr;
     }
 
     SpawnedPickup->SetReplicates(true);
     SpawnedPickup->SetReplicateMovement(true);
     SpawnedPickup->SetItem(ItemData);
-    SpawnedPickup->SetQuantity(1);
+    SpawnedPickup->SetQuantity(Quantity);
     SpawnedPickup->SetPersistentId(FGuid::NewGuid());
     SpawnedPickup->SetWasSpawnedFromInventory(true);
     SpawnedPickup->SetDropped(true);
-
-    Slot.Quantity = FMath::Max(0, Slot.Quantity - 1);
-    if (Slot.Quantity == 0)
-    {
-        Slot.Item = nullptr;
-    }
-
-    MarkInventoryUpdateSource(EInventoryUpdateSource::PlayerAction);
-    BroadcastInventoryChanged();
-    return true;
+    return SpawnedPickup;
 }
 
 void UInventoryComponent::HandleDropAllTimerTick(int32 SlotIndex)
@@ -850,7 +1733,7 @@ void UInventoryComponent::HandleDropAllTimerTick(int32 SlotIndex)
     }
 
     EnsureSlotCapacity();
-    if (!Slots.IsValidIndex(SlotIndex) || Slots[SlotIndex].IsEmpty())
+    if (!IsValidSlotIndex(SlotIndex) || GetSlotContents(SlotIndex).IsEmpty())
     {
         ClearDropAllTimer(SlotIndex);
     }
@@ -873,8 +1756,17 @@ bool UInventoryComponent::TransferItemBetweenSlots(int32 SourceSlotIndex, int32
 {
     if (AActor* OwnerActor = GetOwner())
     {
-        if (OwnerActor->GetLocalRole() != ROLE_Authority)
+        if (OwnerActor->GetLocalRole() != ROLE_Authority && !bApplyingPrediction)
         {
+            if (CanPredictCommands())
+            {
+                FInventoryCommand Command;
+                Command.Type = EInventoryCommandType::Move;
+                Command.SourceSlot = SourceSlotIndex;
+                Command.TargetSlot = TargetSlotIndex;
+                return PredictCommand(Command);
+            }
+
             ServerTransferItemBetweenSlots(SourceSlotIndex, TargetSlotIndex);
             return false;
         }
@@ -887,25 +1779,24 @@ bool UInventoryComponent::TransferItemBetweenSlots(int32 SourceSlotIndex, int32
         return false;
     }
 
-    if (!Slots.IsValidIndex(SourceSlotIndex) || !Slots.IsValidIndex(TargetSlotIndex))
+    if (!IsValidSlotIndex(SourceSlotIndex) || !IsValidSlotIndex(TargetSlotIndex))
     {
         return false;
     }
 
-    FItemStack& SourceSlot = Slots[SourceSlotIndex];
+    const FItemStack SourceSlot = GetSlotContents(SourceSlotIndex);
     if (SourceSlot.IsEmpty())
     {
         return false;
     }
 
-    FItemStack& TargetSlot = Slots[TargetSlotIndex];
+    const FItemStack TargetSlot = GetSlotContents(TargetSlotIndex);
     bool bInventoryChanged = false;
 
     if (TargetSlot.IsEmpty())
     {
-        TargetSlot = SourceSlot;
-        SourceSlot.Item = nullptr;
-        SourceSlot.Quantity = 0;
+        SetSlotContents(TargetSlotIndex, SourceSlot.Item, SourceSlot.Quantity);
+        SetSlotContents(SourceSlotIndex, nullptr, 0);
         bInventoryChanged = true;
     }
     else if (TargetSlot.Item == SourceSlot.Item)
@@ -917,21 +1808,16 @@ bool UInventoryComponent::TransferItemBetweenSlots(int32 SourceSlotIndex, int32
             if (SpaceAvailable > 0)
             {
                 const int32 TransferAmount = FMath::Min(SpaceAvailable, SourceSlot.Quantity);
-                TargetSlot.Quantity += TransferAmount;
-                SourceSlot.Quantity -= TransferAmount;
+                SetSlotContents(TargetSlotIndex, TargetSlot.Item, TargetSlot.Quantity + TransferAmount);
+                SetSlotContents(SourceSlotIndex, SourceSlot.Item, SourceSlot.Quantity - TransferAmount);
                 bInventoryChanged = TransferAmount > 0;
             }
-
-            if (SourceSlot.Quantity <= 0)
-            {
-                SourceSlot.Quantity = 0;
-                SourceSlot.Item = nullptr;
-            }
         }
     }
     else
     {
-        Swap(SourceSlot, TargetSlot);
+        SetSlotContents(TargetSlotIndex, SourceSlot.Item, SourceSlot.Quantity);
+        SetSlotContents(SourceSlotIndex, TargetSlot.Item, TargetSlot.Quantity);
         bInventoryChanged = true;
     }
 
@@ -947,14 +1833,33 @@ bool UInventoryComponent::TransferItemBetweenSlots(int32 SourceSlotIndex, int32
 
 void UInventoryComponent::BroadcastInventoryChanged()
 {
+    ++ContentVersion;
+
+    if (TransactionDepth > 0)
+    {
+        bTransactionHasChanges = true;
+        return;
+    }
+
+    ValidateSlotCaches();
+
+    FInventoryChangeSet ChangeSet;
+    ChangeSet.SlotIndices = PendingChangedSlots.Array();
+    ChangeSet.SlotIndices.Sort();
+    ChangeSet.bLayoutChanged = bPendingLayoutChange;
+    PendingChangedSlots.Reset();
+    bPendingLayoutChange = false;
+
     const TCHAR* SourceString = DescribeInventoryUpdateSource(PendingUpdateSource);
     const FGuid PersistentIdCopy = PersistentId;
-    UE_LOG(LogMOInventoryComponent, Log, TEXT("InventoryUpdate: Owner=%s InventoryId=%s Source=%s Slots=%d"),
+    UE_LOG(LogMOInventoryComponent, Verbose, TEXT("InventoryUpdate: Owner=%s InventoryId=%s Source=%s Slots=%d Changed=%d"),
         *GetNameSafe(GetOwner()),
         PersistentIdCopy.IsValid() ? *PersistentIdCopy.ToString() : TEXT("None"),
         SourceString,
-        Slots.Num());
+        GetNumSlots(),
+        ChangeSet.SlotIndices.Num());
 
+    OnInventoryChanged.Broadcast(ChangeSet);
     OnInventoryUpdated.Broadcast();
 
     if (AActor* OwnerActor = GetOwner())
@@ -968,6 +1873,43 @@ void UInventoryComponent::BroadcastInventoryChanged()
     PendingUpdateSource = EInventoryUpdateSource::PlayerAction;
 }
 
+void UInventoryComponent::BeginTransaction()
+{
+    ++TransactionDepth;
+}
+
+void UInventoryComponent::CommitTransaction()
+{
+    if (!ensureMsgf(TransactionDepth > 0, TEXT("CommitTransaction called without a matching BeginTransaction on %s"), *GetNameSafe(GetOwner())))
+    {
+        return;
+    }
+
+    --TransactionDepth;
+    if (TransactionDepth == 0 && bTransactionHasChanges)
+    {
+        bTransactionHasChanges = false;
+        BroadcastInventoryChanged();
+    }
+}
+
+FInventoryTransaction::FInventoryTransaction(UInventoryComponent* InInventory)
+    : Inventory(InInventory)
+{
+    if (InInventory)
+    {
+        InInventory->BeginTransaction();
+    }
+}
+
+FInventoryTransaction::~FInventoryTransaction()
+{
+    if (UInventoryComponent* InventoryPtr = Inventory.Get())
+    {
+        InventoryPtr->CommitTransaction();
+    }
+}
+
 void UInventoryComponent::MarkInventoryUpdateSource(EInventoryUpdateSource Source)
 {
     PendingUpdateSource = Source;
@@ -990,22 +1932,172 @@ const TCHAR* UInventoryComponent::DescribeInventoryUpdateSource(EInventoryUpdate
 
 void UInventoryComponent::EnsureSlotCapacity()
 {
+    if (!HasSlotAuthority() && (SlotArray.Items.Num() > 0 || bSparseSlotStorage || UsesSparseStorage()))
+    {
+        // Clients take their slot layout from replication; sparse inventories never size local placeholders.
+        return;
+    }
+
     const int32 DesiredSlots = FMath::Max(1, MaxSlots);
-    if (Slots.Num() != DesiredSlots)
+    if (bSparseSlotStorage)
+    {
+        if (SparseSlotCount != DesiredSlots)
+        {
+            CompactToSparseSlots(DesiredSlots);
+        }
+
+        return;
+    }
+
+    if (UsesSparseStorage())
+    {
+        ExpandToDenseSlots();
+    }
+
+    if (SlotArray.Items.Num() != DesiredSlots)
+    {
+        for (int32 Index = DesiredSlots; Index < SlotArray.Items.Num(); ++Index)
+        {
+            RemoveSlotFromCaches(Index, SlotArray.Items[Index]);
+        }
+
+        const int32 PreviousSlots = SlotArray.Items.Num();
+        SlotArray.Items.SetNum(DesiredSlots);
+        FreeSlots.SetNum(DesiredSlots, true);
+
+        for (int32 Index = PreviousSlots; Index < DesiredSlots; ++Index)
+        {
+            SlotArray.Items[Index].SlotIndex = Index;
+        }
+
+        SlotArray.MarkArrayDirty();
+        bPendingLayoutChange = true;
+    }
+}
+
+void UInventoryComponent::CompactToSparseSlots(int32 DesiredSlots)
+{
+    if (!UsesSparseStorage())
+    {
+        // Coming from the dense layout, where an entry's position is its slot.
+        for (int32 Index = 0; Index < SlotArray.Items.Num(); ++Index)
+        {
+            SlotArray.Items[Index].SlotIndex = Index;
+        }
+    }
+
+    // Shrinking drops whatever sat past the new end, exactly like the dense resize.
+    SlotArray.Items.RemoveAll([DesiredSlots](const FItemStack& Slot)
+    {
+        return Slot.IsEmpty() || Slot.SlotIndex < 0 || Slot.SlotIndex >= DesiredSlots;
+    });
+
+    SparseSlotCount = DesiredSlots;
+    RebuildSparseSlotLookup();
+    RebuildSlotCaches();
+
+    SlotArray.MarkArrayDirty();
+    bPendingLayoutChange = true;
+}
+
+void UInventoryComponent::ExpandToDenseSlots()
+{
+    const TArray<FItemStack> StoredSlots = MoveTemp(SlotArray.Items);
+    SlotArray.Items.Reset();
+    SlotArray.Items.SetNum(SparseSlotCount);
+    for (int32 Index = 0; Index < SlotArray.Items.Num(); ++Index)
+    {
+        SlotArray.Items[Index].SlotIndex = Index;
+    }
+
+    for (const FItemStack& Stored : StoredSlots)
+    {
+        if (SlotArray.Items.IsValidIndex(Stored.SlotIndex))
+        {
+            FItemStack& Slot = SlotArray.Items[Stored.SlotIndex];
+            Slot.Item = Stored.Item;
+            Slot.Quantity = Stored.Quantity;
+        }
+    }
+
+    SparseSlotCount = 0;
+    RebuildSparseSlotLookup();
+    MaterializedSlots.Empty();
+    RebuildSlotCaches();
+
+    SlotArray.MarkArrayDirty();
+    bPendingLayoutChange = true;
+}
+
+void UInventoryComponent::RebuildSparseSlotLookup()
+{
+    SparseSlotLookup.Reset();
+    bMaterializedSlotsDirty = true;
+
+    if (!UsesSparseStorage())
+    {
+        return;
+    }
+
+    SparseSlotLookup.Reserve(SlotArray.Items.Num());
+    for (int32 ArrayIndex = 0; ArrayIndex < SlotArray.Items.Num(); ++ArrayIndex)
     {
-        Slots.SetNum(DesiredSlots);
+        const int32 SlotIndex = SlotArray.Items[ArrayIndex].SlotIndex;
+        if (SlotIndex >= 0)
+        {
+            SparseSlotLookup.Add(SlotIndex, ArrayIndex);
+        }
     }
 }
 
+void UInventoryComponent::OnRep_SparseSlotCount()
+{
+    // The layout switched or resized; the per-slot shadow only serves dense inventories.
+    ReplicatedSlotShadow.Reset();
+    RebuildSparseSlotLookup();
+    RebuildSlotCaches();
+
+    bPendingLayoutChange = true;
+    MarkInventoryUpdateSource(EInventoryUpdateSource::PlayerAction);
+    BroadcastInventoryChanged();
+}
+
 #if WITH_EDITOR
 void UInventoryComponent::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
     Super::PostEditChangeProperty(PropertyChangedEvent);
 
-    if (PropertyChangedEvent.Property &&
-        PropertyChangedEvent.Property->GetFName() == GET_MEMBER_NAME_CHECKED(UInventoryComponent, MaxSlots))
+    const FName PropertyName = PropertyChangedEvent.Property ? PropertyChangedEvent.Property->GetFName() : NAME_None;
+    if (PropertyName == GET_MEMBER_NAME_CHECKED(UInventoryComponent, MaxSlots)
+        || PropertyName == GET_MEMBER_NAME_CHECKED(UInventoryComponent, bSparseSlotStorage))
     {
         EnsureSlotCapacity();
     }
 }
+
+void UInventoryComponent::OnRegister()
+{
+    Super::OnRegister();
+
+    UItemData::OnPhysicalPropertiesChanged.AddUObject(this, &UInventoryComponent::HandleItemPhysicalPropertiesChanged);
+}
+
+void UInventoryComponent::OnUnregister()
+{
+    UItemData::OnPhysicalPropertiesChanged.RemoveAll(this);
+
+    Super::OnUnregister();
+}
+
+void UInventoryComponent::HandleItemPhysicalPropertiesChanged(const UItemData* Item)
+{
+    if (!ItemSlotIndex.Contains(Item))
+    {
+        return;
+    }
+
+    RebuildSlotCaches();
+    MarkInventoryUpdateSource(EInventoryUpdateSource::PlayerAction);
+    BroadcastInventoryChanged();
+}
 #endif
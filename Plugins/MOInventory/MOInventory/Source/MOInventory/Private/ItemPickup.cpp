@@ -1,9 +1,55 @@
 #include "ItemPickup.h"
 #include "Components/StaticMeshComponent.h"
+#include "Engine/AssetManager.h"
 #include "Engine/CollisionProfile.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
 #include "InventoryComponent.h"
+#include "ItemPickupMerge.h"
+#include "ItemPickupPool.h"
 #include "MOItems/Public/ItemData.h"
 #include "Net/UnrealNetwork.h"
+#include "UObject/ConstructorHelpers.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogMOItemPickup, Log, All);
+
+namespace
+{
+    static FAutoConsoleCommandWithWorld CCmdPickupNetStats(
+        TEXT("MO56.Pickups.NetStats"),
+        TEXT("Log how many item pickups in the current world are awake, dormant or pooled for replication."),
+        FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+        {
+            if (!World || World->GetNetMode() == NM_Client)
+            {
+                UE_LOG(LogMOItemPickup, Display, TEXT("MO56.Pickups.NetStats is only meaningful on the server."));
+                return;
+            }
+
+            int32 Awake = 0;
+            int32 Dormant = 0;
+            int32 Pooled = 0;
+            for (TActorIterator<AItemPickup> It(World); It; ++It)
+            {
+                if (It->IsPooled())
+                {
+                    ++Pooled;
+                }
+                else if (It->GetNetDormancy() > DORM_Awake)
+                {
+                    ++Dormant;
+                }
+                else
+                {
+                    ++Awake;
+                }
+            }
+
+            UE_LOG(LogMOItemPickup, Display, TEXT("PickupNet: Awake=%d Dormant=%d Pooled=%d"), Awake, Dormant, Pooled);
+        }));
+}
 
 AItemPickup::AItemPickup()
 {
@@ -15,8 +61,22 @@ AItemPickup::AItemPickup()
     Mesh->SetCollisionObjectType(ECC_WorldDynamic);
     Mesh->SetCollisionResponseToAllChannels(ECR_Block);
 
+    static ConstructorHelpers::FObjectFinder<UStaticMesh> PlaceholderMeshFinder(TEXT("/Engine/BasicShapes/Cube.Cube"));
+    PlaceholderMesh = PlaceholderMeshFinder.Object;
+
     bReplicates = true;
     SetReplicateMovement(true);
+
+    // Placed pickups never need an update until they change; dropped ones go dormant once they settle.
+    NetDormancy = DORM_Initial;
+}
+
+void AItemPickup::PostInitProperties()
+{
+    Super::PostInitProperties();
+
+    // Runs after Blueprint defaults are copied in, so subclasses can override PickupNetCullDistance.
+    SetNetCullDistanceSquared(FMath::Square(PickupNetCullDistance));
 }
 
 void AItemPickup::OnConstruction(const FTransform& Transform)
@@ -29,6 +89,12 @@ void AItemPickup::BeginPlay()
 {
     Super::BeginPlay();
 
+    if (bPooled)
+    {
+        ApplyPooledState();
+        return;
+    }
+
     if (HasAuthority())
     {
         if (!PersistentId.IsValid())
@@ -45,19 +111,83 @@ void AItemPickup::BeginPlay()
 
 void AItemPickup::ApplyItemVisuals()
 {
+    if (VisualLoadHandle.IsValid())
+    {
+        VisualLoadHandle->CancelHandle();
+        VisualLoadHandle.Reset();
+    }
+
     if (!Item) { Mesh->SetStaticMesh(nullptr); return; }
 
-    if (UStaticMesh* SM = Item->WorldStaticMesh.LoadSynchronous())
+    if (UStaticMesh* SM = Item->WorldStaticMesh.Get())
     {
-        Mesh->SetStaticMesh(SM);
-        Mesh->SetWorldScale3D(Item->WorldScale3D);
-        Mesh->SetRelativeRotation(Item->WorldRotationOffset);
+        ApplyWorldMesh(SM);
+    }
+    else if (!Item->WorldStaticMesh.IsNull())
+    {
+        const UWorld* World = GetWorld();
+        if (!World || !World->IsGameWorld())
+        {
+            // Editor previews and construction scripts can afford the blocking load.
+            ApplyWorldMesh(Item->WorldStaticMesh.LoadSynchronous());
+        }
+        else
+        {
+            // Show the shared placeholder until the streamer delivers the real mesh.
+            Mesh->SetStaticMesh(PlaceholderMesh);
+            Mesh->SetWorldScale3D(FVector(PlaceholderScale));
+
+            VisualLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+                Item->WorldStaticMesh.ToSoftObjectPath(),
+                FStreamableDelegate::CreateUObject(this, &AItemPickup::HandleWorldMeshLoaded));
+        }
     }
     // (If you add a SkeletalMeshComponent later, check Item->WorldSkeletalMesh here)
 
     Quantity = FMath::Clamp(Quantity, 1, FMath::Max(1, Item->MaxStackSize));
 }
 
+void AItemPickup::HandleWorldMeshLoaded()
+{
+    VisualLoadHandle.Reset();
+
+    if (Item)
+    {
+        ApplyWorldMesh(Item->WorldStaticMesh.Get());
+    }
+}
+
+void AItemPickup::ApplyWorldMesh(UStaticMesh* WorldMesh)
+{
+    if (!WorldMesh || !Item)
+    {
+        return;
+    }
+
+    Mesh->SetStaticMesh(WorldMesh);
+    Mesh->SetWorldScale3D(Item->WorldScale3D);
+    Mesh->SetRelativeRotation(Item->WorldRotationOffset);
+}
+
+TSharedPtr<FStreamableHandle> AItemPickup::PrefetchItemVisuals(const TArray<UItemData*>& Items)
+{
+    TArray<FSoftObjectPath> MeshPaths;
+    for (const UItemData* ItemData : Items)
+    {
+        if (ItemData && !ItemData->WorldStaticMesh.IsNull() && !ItemData->WorldStaticMesh.Get())
+        {
+            MeshPaths.AddUnique(ItemData->WorldStaticMesh.ToSoftObjectPath());
+        }
+    }
+
+    if (MeshPaths.Num() == 0)
+    {
+        return nullptr;
+    }
+
+    return UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(MeshPaths), FStreamableDelegate());
+}
+
 void AItemPickup::OnRep_Quantity()
 {
     Quantity = FMath::Max(0, Quantity);
@@ -67,16 +197,46 @@ void AItemPickup::OnRep_PersistentId()
 {
 }
 
+void AItemPickup::OnRep_Item()
+{
+    ApplyItemVisuals();
+}
+
+void AItemPickup::OnRep_Pooled()
+{
+    ApplyPooledState();
+}
+
 void AItemPickup::SetItem(UItemData* NewItem)
 {
     Item = NewItem;
+    ++SaveStateVersion;
     ApplyItemVisuals();
+    WakeForReplication();
 }
 
 void AItemPickup::SetQuantity(int32 NewQuantity)
 {
     Quantity = FMath::Max(1, NewQuantity);
+    ++SaveStateVersion;
     OnRep_Quantity();
+    WakeForReplication();
+}
+
+void AItemPickup::WakeForReplication()
+{
+    if (!HasAuthority())
+    {
+        return;
+    }
+
+    // Dormant pickups send a single update carrying the change and remain dormant afterwards.
+    if (GetNetDormancy() > DORM_Awake)
+    {
+        FlushNetDormancy();
+    }
+
+    ForceNetUpdate();
 }
 
 void AItemPickup::SetDropped(bool bNewDropped)
@@ -119,33 +279,159 @@ void AItemPickup::StartDropPhysics()
     Mesh->SetCollisionResponseToChannel(ECC_WorldDynamic, ECR_Block);
     Mesh->SetCollisionResponseToChannel(ECC_WorldStatic, ECR_Block);
     Mesh->SetCollisionResponseToChannel(ECC_Pawn, ECR_Block);
+
+    // Settle as soon as the rigid body goes to sleep; the timer only catches bodies that never do.
+    Mesh->BodyInstance.bGenerateWakeEvents = true;
+    Mesh->OnComponentSleep.AddUniqueDynamic(this, &AItemPickup::HandleMeshSleep);
     Mesh->SetSimulatePhysics(true);
 
     GetWorldTimerManager().ClearTimer(DropPhysicsTimerHandle);
-    GetWorldTimerManager().SetTimer(DropPhysicsTimerHandle, this, &AItemPickup::FinishDropPhysics, 3.f, false);
+    GetWorldTimerManager().SetTimer(DropPhysicsTimerHandle, this, &AItemPickup::FinishDropPhysics, FMath::Max(0.1f, DropSettleTimeout), false);
+}
+
+void AItemPickup::HandleMeshSleep(UPrimitiveComponent* SleepingComponent, FName BoneName)
+{
+    if (Dropped)
+    {
+        FinishDropPhysics();
+    }
 }
 
 void AItemPickup::FinishDropPhysics()
 {
+    GetWorldTimerManager().ClearTimer(DropPhysicsTimerHandle);
+
     if (!Mesh)
     {
         Dropped = false;
+        ++SaveStateVersion;
         OnDropSettled.Broadcast(this);
         return;
     }
 
+    ApplyRestingCollision();
+
+    Dropped = false;
+    ++SaveStateVersion;
+
+    if (HasAuthority())
+    {
+        // The resting transform is final: send it once, then stop polling the actor for replication.
+        ForceNetUpdate();
+        SetNetDormancy(DORM_DormantAll);
+
+        if (UItemPickupMergeSubsystem* MergeSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UItemPickupMergeSubsystem>() : nullptr)
+        {
+            if (MergeSubsystem->MergeSettledPickup(this))
+            {
+                // Folded entirely into a neighbouring stack and released.
+                return;
+            }
+        }
+    }
+
+    OnDropSettled.Broadcast(this);
+}
+
+void AItemPickup::RestoreSettled(const FTransform& Transform)
+{
+    GetWorldTimerManager().ClearTimer(DropPhysicsTimerHandle);
+    Dropped = false;
+
+    SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+    ApplyRestingCollision();
+    ++SaveStateVersion;
+
+    if (HasAuthority())
+    {
+        ForceNetUpdate();
+        SetNetDormancy(DORM_DormantAll);
+    }
+
+    OnDropSettled.Broadcast(this);
+}
+
+void AItemPickup::ApplyRestingCollision()
+{
+    if (!Mesh)
+    {
+        return;
+    }
+
     Mesh->SetSimulatePhysics(false);
+    Mesh->BodyInstance.bGenerateWakeEvents = false;
+    Mesh->OnComponentSleep.RemoveDynamic(this, &AItemPickup::HandleMeshSleep);
+
+    // Resting pickups only need to answer traces: no physics body, no overlaps and nothing for pawns or
+    // physics objects to resolve against.
     Mesh->SetCollisionProfileName(UCollisionProfile::BlockAllDynamic_ProfileName);
     Mesh->SetCollisionObjectType(ECC_WorldDynamic);
     Mesh->SetCollisionResponseToAllChannels(ECR_Block);
+    Mesh->SetCollisionResponseToChannel(ECC_Pawn, ECR_Ignore);
+    Mesh->SetCollisionResponseToChannel(ECC_PhysicsBody, ECR_Ignore);
     Mesh->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+    Mesh->SetGenerateOverlapEvents(false);
+    Mesh->bTraceComplexOnMove = false;
+}
+
+void AItemPickup::ApplyPooledState()
+{
+    SetActorHiddenInGame(bPooled);
+    SetActorEnableCollision(!bPooled);
+
+    if (bPooled && Mesh)
+    {
+        Mesh->SetSimulatePhysics(false);
+    }
+}
+
+void AItemPickup::DeactivateForPool()
+{
+    // Listeners (save tracking, UI) treat a pooled pickup exactly like a destroyed one.
+    OnPickupDestroyed.Broadcast(this);
+
+    GetWorldTimerManager().ClearTimer(DropPhysicsTimerHandle);
 
+    bPooled = true;
     Dropped = false;
-    OnDropSettled.Broadcast(this);
+    bWasSpawnedFromInventory = false;
+    PersistentId.Invalidate();
+    ApplyPooledState();
+
+    // Flush the hidden state to clients, then stop considering the actor for replication until reuse.
+    ForceNetUpdate();
+    SetNetDormancy(DORM_DormantAll);
+}
+
+void AItemPickup::ActivateFromPool(const FTransform& Transform, const FGuid& InPersistentId)
+{
+    SetNetDormancy(DORM_Awake);
+
+    const AItemPickup* Defaults = GetClass()->GetDefaultObject<AItemPickup>();
+    Item = Defaults->Item;
+    Quantity = Defaults->Quantity;
+    bPooled = false;
+    ++SaveStateVersion;
+
+    // A new identity keeps the save system from matching this actor against its previous life.
+    PersistentId = InPersistentId.IsValid() ? InPersistentId : FGuid::NewGuid();
+
+    SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+    ApplyRestingCollision();
+    ApplyPooledState();
+    ApplyItemVisuals();
+
+    ForceNetUpdate();
 }
 
 void AItemPickup::Destroyed()
 {
+    if (VisualLoadHandle.IsValid())
+    {
+        VisualLoadHandle->CancelHandle();
+        VisualLoadHandle.Reset();
+    }
+
     OnPickupDestroyed.Broadcast(this);
     Super::Destroyed();
 }
@@ -166,8 +452,14 @@ void AItemPickup::Interact_Implementation(AActor* Interactor)
     const int32 Added = Inv->AddItem(Item, Quantity);
     if (Added <= 0) return;
 
-    if (Added >= Quantity) { Destroy(); }
-    else                   { Quantity -= Added; }
+    if (Added >= Quantity)
+    {
+        UItemPickupPoolSubsystem::ReleaseOrDestroy(this);
+        return;
+    }
+
+    // Partial pickup of a stacked drop: keep the remainder in the world.
+    SetQuantity(Quantity - Added);
 }
 
 FText AItemPickup::GetInteractText_Implementation() const
@@ -185,6 +477,7 @@ void AItemPickup::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifet
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
     DOREPLIFETIME(AItemPickup, Quantity);
     DOREPLIFETIME(AItemPickup, PersistentId);
-    // If you want the Item asset to replicate too (only needed if it can change at runtime):
-    // DOREPLIFETIME_CONDITION(AItemPickup, Item, COND_InitialOnly);
+    // Pooled actors are reused for different items, so the item has to follow them to clients.
+    DOREPLIFETIME(AItemPickup, Item);
+    DOREPLIFETIME(AItemPickup, bPooled);
 }
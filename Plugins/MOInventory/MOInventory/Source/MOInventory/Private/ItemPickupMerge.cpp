@@ -0,0 +1,187 @@
+#include "ItemPickupMerge.h"
+
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "ItemPickup.h"
+#include "ItemPickupPool.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogMOItemPickupMerge, Log, All);
+
+namespace
+{
+    static TAutoConsoleVariable<float> CVarPickupMergeRadius(
+        TEXT("MO56.Pickups.MergeRadius"),
+        150.f,
+        TEXT("Radius (cm) within which settled dropped pickups of the same item merge into one stack. 0 disables merging."),
+        ECVF_Default);
+}
+
+bool UItemPickupMergeSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UItemPickupMergeSubsystem::Deinitialize()
+{
+    Cells.Empty();
+    PickupCells.Empty();
+
+    Super::Deinitialize();
+}
+
+FIntVector UItemPickupMergeSubsystem::ToCell(const FVector& Location, float CellSize)
+{
+    return FIntVector(
+        FMath::FloorToInt32(Location.X / CellSize),
+        FMath::FloorToInt32(Location.Y / CellSize),
+        FMath::FloorToInt32(Location.Z / CellSize));
+}
+
+bool UItemPickupMergeSubsystem::MergeSettledPickup(AItemPickup* Pickup)
+{
+    const UWorld* World = GetWorld();
+    if (!IsValid(Pickup) || !World || World->GetNetMode() == NM_Client || !Pickup->GetItem())
+    {
+        return false;
+    }
+
+    const float Radius = CVarPickupMergeRadius.GetValueOnGameThread();
+    if (Radius <= 0.f)
+    {
+        return false;
+    }
+
+    if (!FMath::IsNearlyEqual(Radius, IndexedCellSize))
+    {
+        // Radius changed: re-bucket everything with the new cell size.
+        TArray<TWeakObjectPtr<AItemPickup>> Indexed;
+        PickupCells.GetKeys(Indexed);
+        Cells.Reset();
+        PickupCells.Reset();
+        IndexedCellSize = Radius;
+
+        for (const TWeakObjectPtr<AItemPickup>& IndexedPickup : Indexed)
+        {
+            if (AItemPickup* Existing = IndexedPickup.Get())
+            {
+                AddToIndex(Existing, Radius);
+            }
+        }
+    }
+
+    RemoveFromIndex(Pickup);
+
+    const FVector Origin = Pickup->GetActorLocation();
+    const FIntVector OriginCell = ToCell(Origin, Radius);
+    const float RadiusSquared = FMath::Square(Radius);
+
+    TArray<TPair<float, AItemPickup*>, TInlineAllocator<16>> Candidates;
+    for (int32 X = -1; X <= 1; ++X)
+    {
+        for (int32 Y = -1; Y <= 1; ++Y)
+        {
+            for (int32 Z = -1; Z <= 1; ++Z)
+            {
+                const TArray<TWeakObjectPtr<AItemPickup>>* CellPickups = Cells.Find(OriginCell + FIntVector(X, Y, Z));
+                if (!CellPickups)
+                {
+                    continue;
+                }
+
+                for (const TWeakObjectPtr<AItemPickup>& CandidatePtr : *CellPickups)
+                {
+                    AItemPickup* Candidate = CandidatePtr.Get();
+                    if (!Candidate || Candidate == Pickup || Candidate->IsPooled() || Candidate->GetItem() != Pickup->GetItem())
+                    {
+                        continue;
+                    }
+
+                    const float DistanceSquared = FVector::DistSquared(Origin, Candidate->GetActorLocation());
+                    if (DistanceSquared <= RadiusSquared)
+                    {
+                        Candidates.Emplace(DistanceSquared, Candidate);
+                    }
+                }
+            }
+        }
+    }
+
+    Candidates.Sort([](const TPair<float, AItemPickup*>& A, const TPair<float, AItemPickup*>& B)
+    {
+        return A.Key < B.Key;
+    });
+
+    const int32 MaxStackSize = FMath::Max(1, Pickup->GetItem()->MaxStackSize);
+    int32 Remaining = Pickup->GetQuantity();
+
+    for (const TPair<float, AItemPickup*>& Candidate : Candidates)
+    {
+        AItemPickup* Target = Candidate.Value;
+        const int32 Space = MaxStackSize - Target->GetQuantity();
+        if (Space <= 0)
+        {
+            continue;
+        }
+
+        const int32 Moved = FMath::Min(Space, Remaining);
+        // SetQuantity bumps the pickup's save-state version, so save tracking rewrites the target on its next refresh.
+        Target->SetQuantity(Target->GetQuantity() + Moved);
+
+        Remaining -= Moved;
+        if (Remaining <= 0)
+        {
+            break;
+        }
+    }
+
+    if (Remaining <= 0)
+    {
+        UE_LOG(LogMOItemPickupMerge, Verbose, TEXT("Merged %s fully into %d neighbour(s)"), *GetNameSafe(Pickup), Candidates.Num());
+        UItemPickupPoolSubsystem::ReleaseOrDestroy(Pickup);
+        return true;
+    }
+
+    if (Remaining != Pickup->GetQuantity())
+    {
+        Pickup->SetQuantity(Remaining);
+    }
+
+    AddToIndex(Pickup, Radius);
+    return false;
+}
+
+void UItemPickupMergeSubsystem::AddToIndex(AItemPickup* Pickup, float CellSize)
+{
+    const FIntVector Cell = ToCell(Pickup->GetActorLocation(), CellSize);
+    Cells.FindOrAdd(Cell).Add(Pickup);
+    PickupCells.Add(Pickup, Cell);
+    Pickup->OnPickupDestroyed.AddUniqueDynamic(this, &UItemPickupMergeSubsystem::HandlePickupRemoved);
+}
+
+void UItemPickupMergeSubsystem::RemoveFromIndex(AItemPickup* Pickup)
+{
+    FIntVector Cell;
+    if (!PickupCells.RemoveAndCopyValue(Pickup, Cell))
+    {
+        return;
+    }
+
+    if (TArray<TWeakObjectPtr<AItemPickup>>* CellPickups = Cells.Find(Cell))
+    {
+        CellPickups->RemoveSwap(Pickup);
+        if (CellPickups->Num() == 0)
+        {
+            Cells.Remove(Cell);
+        }
+    }
+
+    Pickup->OnPickupDestroyed.RemoveDynamic(this, &UItemPickupMergeSubsystem::HandlePickupRemoved);
+}
+
+void UItemPickupMergeSubsystem::HandlePickupRemoved(AItemPickup* Pickup)
+{
+    if (Pickup)
+    {
+        RemoveFromIndex(Pickup);
+    }
+}
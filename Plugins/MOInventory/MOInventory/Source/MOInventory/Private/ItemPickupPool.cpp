@@ -0,0 +1,255 @@
+#include "ItemPickupPool.h"
+
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/IConsoleManager.h"
+#include "ItemPickup.h"
+#include "TimerManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogMOItemPickupPool, Log, All);
+
+namespace
+{
+    static TAutoConsoleVariable<int32> CVarPickupPoolEnabled(
+        TEXT("MO56.Pickups.Pool"),
+        1,
+        TEXT("Recycle dropped item pickups through a per-class actor pool instead of spawning and destroying them."),
+        ECVF_Default);
+
+    static TAutoConsoleVariable<int32> CVarPickupPoolPrewarm(
+        TEXT("MO56.Pickups.PoolPrewarm"),
+        8,
+        TEXT("Number of hidden pickups kept ready per pickup class once that class is first used."),
+        ECVF_Default);
+
+    static TAutoConsoleVariable<int32> CVarPickupPoolMaxPerClass(
+        TEXT("MO56.Pickups.PoolMaxPerClass"),
+        64,
+        TEXT("Maximum number of pooled pickups retained per pickup class; further releases are destroyed."),
+        ECVF_Default);
+
+    static FAutoConsoleCommandWithWorld CCmdPickupPoolStats(
+        TEXT("MO56.Pickups.PoolStats"),
+        TEXT("Log item pickup pool hit/miss statistics for the current world."),
+        FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+        {
+            const UItemPickupPoolSubsystem* Pool = World ? World->GetSubsystem<UItemPickupPoolSubsystem>() : nullptr;
+            if (!Pool)
+            {
+                UE_LOG(LogMOItemPickupPool, Display, TEXT("No pickup pool in this world."));
+                return;
+            }
+
+            const FItemPickupPoolStats Stats = Pool->GetStats();
+            const int32 Acquires = Stats.Hits + Stats.Misses;
+            UE_LOG(LogMOItemPickupPool, Display, TEXT("PickupPool: Hits=%d Misses=%d HitRate=%.1f%% Releases=%d Overflows=%d Prewarmed=%d Available=%d"),
+                Stats.Hits,
+                Stats.Misses,
+                Acquires > 0 ? 100.f * Stats.Hits / Acquires : 0.f,
+                Stats.Releases,
+                Stats.Overflows,
+                Stats.Prewarmed,
+                Stats.Available);
+        }));
+}
+
+bool UItemPickupPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UItemPickupPoolSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    if (CanPool())
+    {
+        Prewarm(AItemPickup::StaticClass(), CVarPickupPoolPrewarm.GetValueOnGameThread());
+    }
+}
+
+void UItemPickupPoolSubsystem::Deinitialize()
+{
+    Buckets.Empty();
+    Stats = FItemPickupPoolStats();
+
+    Super::Deinitialize();
+}
+
+bool UItemPickupPoolSubsystem::CanPool() const
+{
+    const UWorld* World = GetWorld();
+    return World && World->GetNetMode() != NM_Client && CVarPickupPoolEnabled.GetValueOnGameThread() != 0;
+}
+
+AItemPickup* UItemPickupPoolSubsystem::AcquirePickup(TSubclassOf<AItemPickup> PickupClass, const FTransform& Transform, AActor* PickupOwner, APawn* PickupInstigator)
+{
+    return AcquirePickupWithId(PickupClass, Transform, FGuid(), PickupOwner, PickupInstigator);
+}
+
+AItemPickup* UItemPickupPoolSubsystem::AcquirePickupWithId(TSubclassOf<AItemPickup> PickupClass, const FTransform& Transform, const FGuid& PersistentId, AActor* PickupOwner, APawn* PickupInstigator)
+{
+    UWorld* World = GetWorld();
+    if (!World || !PickupClass || World->GetNetMode() == NM_Client)
+    {
+        return nullptr;
+    }
+
+    if (CanPool())
+    {
+        const bool bKnownClass = Buckets.Contains(PickupClass.Get());
+        FItemPickupPoolBucket& Bucket = Buckets.FindOrAdd(PickupClass.Get());
+
+        while (Bucket.Available.Num() > 0)
+        {
+            AItemPickup* Pickup = Bucket.Available.Pop(EAllowShrinking::No);
+            if (!IsValid(Pickup))
+            {
+                continue;
+            }
+
+            --Stats.Available;
+            ++Stats.Hits;
+
+            Pickup->SetOwner(PickupOwner);
+            Pickup->SetInstigator(PickupInstigator);
+            Pickup->ActivateFromPool(Transform, PersistentId);
+            OnPickupActivated.Broadcast(Pickup);
+            return Pickup;
+        }
+
+        ++Stats.Misses;
+
+        if (!bKnownClass)
+        {
+            // First use of this class: fill its bucket on the next tick rather than inside the current spike.
+            const TWeakObjectPtr<UClass> WeakClass = PickupClass.Get();
+            World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateWeakLambda(this, [this, WeakClass]()
+            {
+                if (UClass* ClassToWarm = WeakClass.Get())
+                {
+                    Prewarm(ClassToWarm, CVarPickupPoolPrewarm.GetValueOnGameThread());
+                }
+            }));
+        }
+    }
+
+    AItemPickup* Pickup = World->SpawnActorDeferred<AItemPickup>(PickupClass, Transform, PickupOwner, PickupInstigator,
+        ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn);
+    if (Pickup)
+    {
+        if (PersistentId.IsValid())
+        {
+            Pickup->SetPersistentId(PersistentId);
+        }
+
+        Pickup->FinishSpawning(Transform);
+    }
+
+    return Pickup;
+}
+
+void UItemPickupPoolSubsystem::ReleasePickup(AItemPickup* Pickup)
+{
+    if (!IsValid(Pickup) || Pickup->IsActorBeingDestroyed() || Pickup->IsPooled())
+    {
+        return;
+    }
+
+    if (!CanPool() || Pickup->GetWorld() != GetWorld())
+    {
+        Pickup->Destroy();
+        return;
+    }
+
+    FItemPickupPoolBucket& Bucket = Buckets.FindOrAdd(Pickup->GetClass());
+    if (Bucket.Available.Num() >= FMath::Max(0, CVarPickupPoolMaxPerClass.GetValueOnGameThread()))
+    {
+        ++Stats.Overflows;
+        Pickup->Destroy();
+        return;
+    }
+
+    Pickup->DeactivateForPool();
+    Bucket.Available.Add(Pickup);
+    ++Stats.Available;
+    ++Stats.Releases;
+}
+
+void UItemPickupPoolSubsystem::Prewarm(TSubclassOf<AItemPickup> PickupClass, int32 Count)
+{
+    if (!PickupClass || !CanPool())
+    {
+        return;
+    }
+
+    FItemPickupPoolBucket& Bucket = Buckets.FindOrAdd(PickupClass.Get());
+    const int32 Target = FMath::Min(Count, CVarPickupPoolMaxPerClass.GetValueOnGameThread());
+
+    while (Bucket.Available.Num() < Target)
+    {
+        AItemPickup* Pickup = SpawnPooledPickup(PickupClass.Get());
+        if (!Pickup)
+        {
+            UE_LOG(LogMOItemPickupPool, Warning, TEXT("Prewarm: failed to spawn %s"), *GetNameSafe(PickupClass.Get()));
+            break;
+        }
+
+        Bucket.Available.Add(Pickup);
+        ++Stats.Available;
+        ++Stats.Prewarmed;
+    }
+}
+
+FItemPickupPoolStats UItemPickupPoolSubsystem::GetStats() const
+{
+    return Stats;
+}
+
+AItemPickup* UItemPickupPoolSubsystem::SpawnPooledPickup(UClass* PickupClass)
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return nullptr;
+    }
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+    // Mark the actor pooled before it finishes spawning so actor-spawned listeners (e.g. the save system) skip it.
+    SpawnParams.CustomPreSpawnInitalization = [](AActor* Actor)
+    {
+        if (AItemPickup* Pickup = Cast<AItemPickup>(Actor))
+        {
+            Pickup->bPooled = true;
+        }
+    };
+
+    AItemPickup* Pickup = World->SpawnActor<AItemPickup>(PickupClass, FTransform::Identity, SpawnParams);
+    if (Pickup)
+    {
+        Pickup->DeactivateForPool();
+    }
+
+    return Pickup;
+}
+
+void UItemPickupPoolSubsystem::ReleaseOrDestroy(AItemPickup* Pickup)
+{
+    if (!Pickup)
+    {
+        return;
+    }
+
+    if (UWorld* World = Pickup->GetWorld())
+    {
+        if (UItemPickupPoolSubsystem* Pool = World->GetSubsystem<UItemPickupPoolSubsystem>())
+        {
+            Pool->ReleasePickup(Pickup);
+            return;
+        }
+    }
+
+    Pickup->Destroy();
+}
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "UObject/SoftObjectPath.h"
+#include "Net/Serialization/FastArraySerializer.h"
 #include "InventoryComponent.generated.h"
 
 enum class EInventoryUpdateSource : uint8
@@ -14,8 +15,11 @@ enum class EInventoryUpdateSource : uint8
     PossessionSwitch
 };
 
+class AController;
+class AItemPickup;
 class UItemData;
 class UInventoryComponent;
+class UPackageMap;
 struct FPropertyChangedEvent;
 struct FTimerHandle;
 
@@ -31,6 +35,10 @@ struct MOINVENTORY_API FInventorySlotSaveData
     /** Quantity stored in the slot. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Inventory")
     int32 Quantity = 0;
+
+    /** Slot this entry is restored into. INDEX_NONE (older saves, which stored every slot) uses the entry's position. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Inventory")
+    int32 SlotIndex = INDEX_NONE;
 };
 
 USTRUCT(BlueprintType)
@@ -54,27 +62,183 @@ struct MOINVENTORY_API FInventorySaveData
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Inventory")
     FGuid OwnerCharacterId;
 
-    /** Serialized representation of all slots. */
+    /** Occupied slots, each tagged with its SlotIndex; empty slots are not written. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Inventory")
     TArray<FInventorySlotSaveData> Slots;
 };
 
+/** Kind of per-slot delta delivered to clients by the slot fast array. */
+UENUM(BlueprintType)
+enum class EInventorySlotChange : uint8
+{
+    Added,
+    Changed,
+    Removed
+};
+
+/** How DropItemAtIndex puts a whole stack into the world. */
+UENUM(BlueprintType)
+enum class EInventoryDropMode : uint8
+{
+    /** One pickup carrying the whole stack. */
+    Stacked,
+    /** One pickup per unit, released on a short repeating timer. */
+    PerUnit
+};
+
+struct FInventorySlotArray;
+
 USTRUCT(BlueprintType)
-struct MOINVENTORY_API FItemStack
+struct MOINVENTORY_API FItemStack : public FFastArraySerializerItem
 {
     GENERATED_BODY()
 
+    FItemStack() = default;
+    FItemStack(UItemData* InItem, int32 InQuantity) : Item(InItem), Quantity(InQuantity) {}
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     TObjectPtr<UItemData> Item = nullptr;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     int32 Quantity = 0;
 
+    /** Slot this entry occupies. Replicated so clients can place entries regardless of fast-array order. */
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+    int32 SlotIndex = INDEX_NONE;
+
     bool IsEmpty() const { return Item == nullptr || Quantity <= 0; }
     int32 MaxStack() const; // defined in .cpp
 };
 
+/** Fast-array wrapper for inventory slots; only slots marked dirty are sent to clients. */
+USTRUCT()
+struct MOINVENTORY_API FInventorySlotArray : public FFastArraySerializer
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<FItemStack> Items;
+
+    /** Component that receives client-side slot callbacks. */
+    UPROPERTY(NotReplicated)
+    TObjectPtr<UInventoryComponent> Owner = nullptr;
+
+    void PreReplicatedRemove(const TArrayView<int32> RemovedIndices, int32 FinalSize);
+    void PostReplicatedAdd(const TArrayView<int32> AddedIndices, int32 FinalSize);
+    void PostReplicatedChange(const TArrayView<int32> ChangedIndices, int32 FinalSize);
+    void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters);
+
+    bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms);
+
+private:
+    /** Set when a received entry landed at an array index different from its SlotIndex. */
+    bool bNeedsSlotOrderFixup = false;
+
+    /** Set on clients once locally sized placeholder slots have been discarded. */
+    bool bReceivedServerSlots = false;
+};
+
+template<>
+struct TStructOpsTypeTraits<FInventorySlotArray> : public TStructOpsTypeTraitsBase2<FInventorySlotArray>
+{
+    enum
+    {
+        WithNetDeltaSerializer = true,
+    };
+};
+
+/** Slots holding one item type, sorted ascending, plus their combined quantity. */
+struct FInventoryItemSlotIndex
+{
+    TArray<int32, TInlineAllocator<4>> SlotIndices;
+    int32 TotalQuantity = 0;
+
+    /** Per-unit values added to the running totals for these slots; removals subtract exactly these. */
+    double UnitWeightKg = 0.0;
+    double UnitVolumeM3 = 0.0;
+};
+
+/** Slots touched since the previous inventory notification. */
+USTRUCT(BlueprintType)
+struct MOINVENTORY_API FInventoryChangeSet
+{
+    GENERATED_BODY()
+
+    /** Indices of the slots whose contents may have changed, in ascending order. */
+    UPROPERTY(BlueprintReadOnly, Category = "Inventory")
+    TArray<int32> SlotIndices;
+
+    /** True when the number of slots changed; consumers should rebuild rather than patch. */
+    UPROPERTY(BlueprintReadOnly, Category = "Inventory")
+    bool bLayoutChanged = false;
+};
+
+/** Operations that can be sent to the server in a single batched command RPC. */
+UENUM(BlueprintType)
+enum class EInventoryCommandType : uint8
+{
+    /** Move/merge/swap SourceSlot onto TargetSlot (TransferItemBetweenSlots). */
+    Move,
+    /** Split SourceSlot in half into the first free slot. */
+    Split,
+    /** Merge SourceSlot into TargetSlot; fails unless both hold the same item. */
+    Merge,
+    /** Drop the whole stack at SourceSlot into the world as a single pickup. */
+    Drop,
+    /** Move SourceSlot into TargetSlot of OtherInventory. */
+    TransferToInventory,
+    /** Take every stack from OtherInventory. */
+    TakeAll
+};
+
+/** Compact, net-serialized inventory operation used by UInventoryComponent::SubmitCommands. */
+USTRUCT(BlueprintType)
+struct MOINVENTORY_API FInventoryCommand
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Inventory")
+    EInventoryCommandType Type = EInventoryCommandType::Move;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Inventory")
+    int32 SourceSlot = INDEX_NONE;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Inventory")
+    int32 TargetSlot = INDEX_NONE;
+
+    /** Target for TransferToInventory, source for TakeAll. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Inventory")
+    TObjectPtr<UInventoryComponent> OtherInventory = nullptr;
+
+    bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FInventoryCommand> : public TStructOpsTypeTraitsBase2<FInventoryCommand>
+{
+    enum
+    {
+        WithNetSerializer = true,
+    };
+};
+
+/** Command applied locally on a client ahead of the server, keyed by its batch sequence number. */
+struct FPredictedInventoryCommand
+{
+    int32 PredictionKey = 0;
+    FInventoryCommand Command;
+
+    /** Set once this client's acknowledgement reports the batch applied; the next slot update then retires it. */
+    bool bAcknowledged = false;
+};
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnInventoryUpdated);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInventoryChanged, const FInventoryChangeSet&, ChangeSet);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnInventorySlotChanged, int32, SlotIndex, EInventorySlotChange, Change);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnInventoryCommandsAcknowledged, int32, Sequence, bool, bSucceeded);
+
+/** Decides whether the requesting player may use an inventory through a client RPC. */
+DECLARE_DELEGATE_RetVal_OneParam(bool, FInventoryAccessCheck, const AController* /*Requester*/);
 
 UCLASS(ClassGroup = (Inventory), meta = (BlueprintSpawnableComponent))
 class MOINVENTORY_API UInventoryComponent : public UActorComponent
@@ -102,6 +266,50 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "Inventory")
     FOnInventoryUpdated OnInventoryUpdated;
 
+    /** Broadcast alongside OnInventoryUpdated with the slots touched since the last notification. */
+    UPROPERTY(BlueprintAssignable, Category = "Inventory")
+    FOnInventoryChanged OnInventoryChanged;
+
+    /** Broadcast on clients for every slot delta received from the server, before OnInventoryUpdated. */
+    UPROPERTY(BlueprintAssignable, Category = "Inventory")
+    FOnInventorySlotChanged OnSlotReplicated;
+
+    /** Broadcast on the submitting machine once the server has applied or rejected a command batch. */
+    UPROPERTY(BlueprintAssignable, Category = "Inventory")
+    FOnInventoryCommandsAcknowledged OnCommandsAcknowledged;
+
+    /**
+     * When true, owning clients apply slot moves, splits and merges immediately and reconcile against the
+     * replicated result instead of waiting a full round trip.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Inventory|Networking")
+    bool bPredictClientMoves = true;
+
+    /** Controls whether dropping a stack spawns a single pickup or one pickup per unit. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Inventory")
+    EInventoryDropMode DropMode = EInventoryDropMode::Stacked;
+
+    /**
+     * Stores and replicates only occupied slots instead of MaxSlots entries. Intended for high-capacity
+     * containers such as community storage; UI should read it through GetSlotPage rather than GetSlots.
+     * Client-side move prediction is disabled for sparse inventories.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Inventory|Storage")
+    bool bSparseSlotStorage = false;
+
+    /**
+     * Server-side access rule for client RPCs that name this inventory, either as the inventory receiving the
+     * commands or as the other side of a transfer or take-all. Unbound, only the controller owning this
+     * inventory's actor may use it; shared owners such as containers bind their own rule.
+     */
+    FInventoryAccessCheck AccessCheck;
+
+    /** True when Requester may use this inventory through a client RPC. Server only. */
+    bool CanBeAccessedBy(const AController* Requester) const;
+
+    /** Upper bound on commands accepted in one batch. */
+    static constexpr int32 MaxCommandsPerBatch = 64;
+
     /** Persistent identifier used when serializing this inventory to a save game. */
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Inventory|Save")
     FGuid PersistentId;
@@ -130,12 +338,64 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Inventory")
     bool DropSingleItemAtIndex(int32 SlotIndex);
 
+    /** Merges partial stacks and orders the slots by item display name. */
+    UFUNCTION(BlueprintCallable, Category = "Inventory")
+    bool SortSlots();
+
+    /** Moves as much as fits from every slot of the source inventory into this one. Returns the number of items moved. */
+    UFUNCTION(BlueprintCallable, Category = "Inventory")
+    int32 TakeAllFromInventory(UInventoryComponent* SourceInventory);
+
+    /**
+     * Sends an ordered list of commands to the server in one RPC. The server applies them all or none
+     * (slot changes are rolled back if any command fails) and acknowledges with the returned sequence
+     * number through OnCommandsAcknowledged.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Inventory")
+    int32 SubmitCommands(const TArray<FInventoryCommand>& Commands);
+
+    /**
+     * Opens a transaction. Change notifications are held until the outermost transaction commits, then
+     * sent once with every touched slot. Transactions nest; prefer FInventoryTransaction in C++.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Inventory")
+    void BeginTransaction();
+
+    /** Closes the innermost transaction and flushes pending notifications when it was the outermost. */
+    UFUNCTION(BlueprintCallable, Category = "Inventory")
+    void CommitTransaction();
+
+    UFUNCTION(BlueprintPure, Category = "Inventory")
+    bool IsInTransaction() const { return TransactionDepth > 0; }
+
     /** Moves an item from this inventory to the target inventory. */
     UFUNCTION(BlueprintCallable, Category = "Inventory")
     bool TransferItemToInventory(UInventoryComponent* TargetInventory, int32 SourceSlotIndex, int32 TargetSlotIndex);
 
+    /**
+     * Every slot, indexed by slot. Sparse inventories build this dense copy on demand, which costs
+     * O(MaxSlots); prefer GetNumSlots and GetSlotPage for large containers.
+     */
     UFUNCTION(BlueprintPure, Category = "Inventory")
-    const TArray<FItemStack>& GetSlots() const { return Slots; }
+    const TArray<FItemStack>& GetSlots() const;
+
+    /** Number of addressable slots, whether or not they are stored. */
+    UFUNCTION(BlueprintPure, Category = "Inventory")
+    int32 GetNumSlots() const { return UsesSparseStorage() ? SparseSlotCount : SlotArray.Items.Num(); }
+
+    /** Copies up to Count slots starting at FirstSlotIndex into OutSlots, filling unstored slots with empty stacks. */
+    UFUNCTION(BlueprintCallable, Category = "Inventory")
+    void GetSlotPage(int32 FirstSlotIndex, int32 Count, TArray<FItemStack>& OutSlots) const;
+
+    /** True when only occupied slots are stored and replicated. */
+    UFUNCTION(BlueprintPure, Category = "Inventory|Storage")
+    bool UsesSparseStorage() const { return SparseSlotCount > 0; }
+
+    /**
+     * Entries actually held, each tagged with its SlotIndex: every slot for dense inventories, only the
+     * occupied ones in no particular order for sparse inventories. Cheapest way to visit the contents.
+     */
+    const TArray<FItemStack>& GetStoredSlots() const { return SlotArray.Items; }
 
     /** Returns true if all slots are empty. */
     UFUNCTION(BlueprintPure, Category = "Inventory")
@@ -174,24 +434,126 @@ public:
     /** Restores inventory content from serialized save data. */
     void ReadFromSaveData(const FInventorySaveData& InData);
 
+    /** Increments whenever the contents change; lets savers skip inventories that are unchanged since their last capture. */
+    uint32 GetContentVersion() const { return ContentVersion; }
+
 private:
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, ReplicatedUsing = OnRep_Slots, Category = "Inventory", meta = (AllowPrivateAccess = "true"))
-    TArray<FItemStack> Slots;
+    /** Slot count of a sparse inventory; 0 while every slot is stored. Replicated ahead of the slots it describes. */
+    UPROPERTY(ReplicatedUsing = OnRep_SparseSlotCount)
+    int32 SparseSlotCount = 0;
+
+    UPROPERTY(VisibleAnywhere, Replicated, Category = "Inventory")
+    FInventorySlotArray SlotArray;
+
+    friend struct FInventorySlotArray;
 
     int32 AddToExistingStacks(UItemData* Item, int32 Count);
     int32 AddToEmptySlots(UItemData* Item, int32 Count);
     void EnsureSlotCapacity();
 
     bool DropSingleItemInternal(int32 SlotIndex);
+    bool DropStackInternal(int32 SlotIndex);
+
+    /** Spawns a dropped pickup holding Quantity units in front of the owner. Authority only. */
+    AItemPickup* SpawnDroppedPickup(UItemData* ItemData, int32 Quantity);
+
+    bool ApplyCommandBatch(const TArray<FInventoryCommand>& Commands);
+
+    /** Controller found by walking the owner chain of this inventory's actor; the connection its RPCs arrive on. */
+    AController* GetOwningController() const;
+
+    /** True when the controller that sent an RPC to this inventory may use this inventory and Other (when set). */
+    bool CanRequesterUse(const UInventoryComponent* Other) const;
+    bool ApplyCommand(const FInventoryCommand& Command, TArray<FItemStack>& OutPendingDrops);
+    void RollbackUndoSlots();
     void HandleDropAllTimerTick(int32 SlotIndex);
     void ClearDropAllTimer(int32 SlotIndex);
 
     void ResolveItemIntoSlot(const FInventorySlotSaveData& SlotData, FItemStack& Slot);
 
-    TMap<int32, FTimerHandle> ActiveDropAllTimers;
+    bool IsValidSlotIndex(int32 SlotIndex) const { return SlotIndex >= 0 && SlotIndex < GetNumSlots(); }
+
+    /** Contents of a slot in either storage mode; unstored and out-of-range slots read as an empty stack. */
+    const FItemStack& GetSlotContents(int32 SlotIndex) const;
+
+    /** Single write path for slot contents; keeps the totals, item index and free-slot bits in sync. */
+    void SetSlotContents(int32 SlotIndex, UItemData* Item, int32 Quantity);
+    void SetSparseSlotContents(int32 SlotIndex, UItemData* Item, int32 Quantity);
+    void RemoveSlotFromCaches(int32 SlotIndex, const FItemStack& Slot);
+    void AddSlotToCaches(int32 SlotIndex, const FItemStack& Slot);
+    void RebuildSlotCaches();
+
+    /** True when this instance owns the slot layout (server, standalone or editor). */
+    bool HasSlotAuthority() const;
+
+    /**
+     * Non-shipping drift check controlled by MO56.Inventory.ValidateTotals. Recomputes the totals and item
+     * quantities from the stored slots and compares them with the running caches without modifying them;
+     * runs once per broadcast rather than per slot write.
+     */
+    void ValidateSlotCaches();
+
+    /** Running totals maintained by SetSlotContents so capacity queries do not walk the slots. */
+    double TotalWeight = 0.0;
+    double TotalVolume = 0.0;
+
+    /** Item -> occupied slots, so lookups scale with matching stacks rather than MaxSlots. */
+    TMap<const UItemData*, FInventoryItemSlotIndex> ItemSlotIndex;
+
+    /** One bit per slot; set when the slot is empty. */
+    TBitArray<> FreeSlots;
+
+    /** Sparse storage: slot index -> position in SlotArray.Items. */
+    TMap<int32, int32> SparseSlotLookup;
+    void RebuildSparseSlotLookup();
+
+    /** Converts SlotArray between dense and sparse layouts to match bSparseSlotStorage. Authority only. */
+    void CompactToSparseSlots(int32 DesiredSlots);
+    void ExpandToDenseSlots();
 
     UFUNCTION()
-    void OnRep_Slots();
+    void OnRep_SparseSlotCount();
+
+    /** Dense copy handed out by GetSlots for sparse inventories, rebuilt after the slots change. */
+    mutable TArray<FItemStack> MaterializedSlots;
+    mutable bool bMaterializedSlotsDirty = true;
+
+    TMap<int32, FTimerHandle> ActiveDropAllTimers;
+
+    /** Client-side handlers driven by FInventorySlotArray callbacks. */
+    void HandleReplicatedSlotUpdated(const FItemStack& Slot, EInventorySlotChange Change);
+    void HandleReplicatedSlotRemoved(const FItemStack& Slot);
+    void HandleSlotsReplicated();
+
+    /** Last replicated contents per slot index, used to keep client totals incremental. */
+    TArray<FItemStack> ReplicatedSlotShadow;
+
+    /** Applies Command locally and sends it to the server tagged with a prediction key. */
+    bool PredictCommand(const FInventoryCommand& Command);
+    bool ApplyPredictedCommand(const FInventoryCommand& Command);
+
+    /**
+     * Rewinds predicted slots to their replicated values and replays predictions the server has not answered yet.
+     * bRetireAcknowledged drops predictions this client already saw acknowledged, for slot updates that carry them.
+     */
+    void ReconcilePredictions(bool bRetireAcknowledged);
+
+    /**
+     * Predictions need a replicated baseline to rewind to, which sparse inventories do not keep, and an owning
+     * connection: the server drops RPCs sent through an actor this client does not own yet, so nothing would answer.
+     */
+    bool CanPredictCommands() const { return bPredictClientMoves && !UsesSparseStorage() && ReplicatedSlotShadow.Num() > 0 && IsOwnedByLocalConnection(); }
+    bool HasPendingPredictions() const { return PredictedCommands.Num() > 0 || PredictedSlots.Num() > 0; }
+
+    /** True when this client can send server RPCs through the inventory's actor. */
+    bool IsOwnedByLocalConnection() const;
+
+    /** Outstanding predictions of this client only; acknowledgements arrive per connection through ClientAcknowledgeCommands. */
+    TArray<FPredictedInventoryCommand> PredictedCommands;
+
+    /** Slots whose local contents differ from ReplicatedSlotShadow because of a prediction. */
+    TSet<int32> PredictedSlots;
+    bool bApplyingPrediction = false;
 
     void BroadcastInventoryChanged();
     void MarkInventoryUpdateSource(EInventoryUpdateSource Source);
@@ -215,14 +577,58 @@ private:
     UFUNCTION(Server, Reliable)
     void ServerTransferItemToInventory(UInventoryComponent* TargetInventory, int32 SourceSlotIndex, int32 TargetSlotIndex);
 
+    UFUNCTION(Server, Reliable)
+    void ServerSortSlots();
+
+    UFUNCTION(Server, Reliable)
+    void ServerTakeAllFromInventory(UInventoryComponent* SourceInventory);
+
+    UFUNCTION(Server, Reliable)
+    void ServerExecuteCommands(const TArray<FInventoryCommand>& Commands, int32 Sequence);
+
+    UFUNCTION(Client, Reliable)
+    void ClientAcknowledgeCommands(int32 Sequence, bool bSucceeded);
+
     UFUNCTION(Server, Reliable)
     void ServerDebugSetSlot(int32 SlotIndex, UItemData* Item, int32 Quantity);
 
 #if WITH_EDITOR
     virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+    virtual void OnRegister() override;
+    virtual void OnUnregister() override;
+
+    /** Rebuilds the totals when an item held here is re-baked with different per-unit values. */
+    void HandleItemPhysicalPropertiesChanged(const UItemData* Item);
 #endif
 
     virtual void PostInitProperties() override;
+    virtual void PostLoad() override;
 
     EInventoryUpdateSource PendingUpdateSource = EInventoryUpdateSource::PlayerAction;
+
+    /** Slots touched since the last broadcast; becomes the next FInventoryChangeSet. */
+    TSet<int32> PendingChangedSlots;
+    bool bPendingLayoutChange = false;
+
+    int32 TransactionDepth = 0;
+    bool bTransactionHasChanges = false;
+
+    uint32 ContentVersion = 0;
+
+    /** Original contents of slots touched while a command batch is applied, for rollback. */
+    TMap<int32, FItemStack> UndoSlots;
+    bool bRecordingUndo = false;
+
+    int32 NextCommandSequence = 0;
+};
+
+/** RAII wrapper around UInventoryComponent::BeginTransaction/CommitTransaction. */
+class MOINVENTORY_API FInventoryTransaction : public FNoncopyable
+{
+public:
+    explicit FInventoryTransaction(UInventoryComponent* InInventory);
+    ~FInventoryTransaction();
+
+private:
+    TWeakObjectPtr<UInventoryComponent> Inventory;
 };
@@ -3,8 +3,11 @@
 #include "GameFramework/Actor.h"
 #include "TimerManager.h"
 #include "Interactable.h"
+#include "Engine/StreamableManager.h"
 #include "ItemPickup.generated.h"
 
+class UPrimitiveComponent;
+class UStaticMesh;
 class UStaticMeshComponent;
 class UItemData;
 
@@ -23,7 +26,7 @@ protected:
     UStaticMeshComponent* Mesh;
 
     // The ONLY source now: set this in your BP (e.g., BP_ApplePickup -> DA_Apple)
-    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Pickup")
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, ReplicatedUsing=OnRep_Item, Category="Pickup")
     TObjectPtr<UItemData> Item = nullptr;
 
     UPROPERTY(EditAnywhere, ReplicatedUsing=OnRep_Quantity, Category="Pickup", meta=(ClampMin="1"))
@@ -32,6 +35,14 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Pickup")
     bool Dropped = false;
 
+    /** Pickups are small; clients farther than this do not receive them at all. */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Pickup|Networking", meta=(ClampMin="0", ForceUnits="cm"))
+    float PickupNetCullDistance = 5000.f;
+
+    /** Seconds a dropped pickup may simulate before it is forced to settle if its body never goes to sleep. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Pickup", meta=(ClampMin="0.1", ForceUnits="s"))
+    float DropSettleTimeout = 3.f;
+
     /** True when the pickup originated from a player inventory drop. */
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Pickup|Save")
     bool bWasSpawnedFromInventory = false;
@@ -40,21 +51,41 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadOnly, ReplicatedUsing=OnRep_PersistentId, Category="Pickup|Save")
     FGuid PersistentId;
 
+    virtual void PostInitProperties() override;
     virtual void OnConstruction(const FTransform& Transform) override;
     virtual void BeginPlay() override;
     virtual void Destroyed() override;
 
+    /** Applies the item's world mesh, streaming it asynchronously behind PlaceholderMesh in game worlds. */
     void ApplyItemVisuals();
+    void ApplyWorldMesh(UStaticMesh* WorldMesh);
+    void HandleWorldMeshLoaded();
+
+    /** Lightweight mesh shown while the item's world mesh streams in. Shared by every pickup of the class. */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Pickup|Visuals")
+    TObjectPtr<UStaticMesh> PlaceholderMesh;
+
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Pickup|Visuals", meta=(ClampMin="0.01"))
+    float PlaceholderScale = 0.2f;
 
     void StartDropPhysics();
     void FinishDropPhysics();
 
+    UFUNCTION()
+    void HandleMeshSleep(UPrimitiveComponent* SleepingComponent, FName BoneName);
+
     UFUNCTION()
     void OnRep_Quantity();
 
     UFUNCTION()
     void OnRep_PersistentId();
 
+    UFUNCTION()
+    void OnRep_Item();
+
+    UFUNCTION()
+    void OnRep_Pooled();
+
 public:
     virtual void Interact_Implementation(AActor* Interactor) override;
     virtual FText GetInteractText_Implementation() const override;
@@ -80,7 +111,10 @@ public:
     bool WasSpawnedFromInventory() const { return bWasSpawnedFromInventory; }
 
     UFUNCTION(BlueprintCallable, Category="Pickup|Save")
-    void SetWasSpawnedFromInventory(bool bInSpawnedFromInventory) { bWasSpawnedFromInventory = bInSpawnedFromInventory; }
+    void SetWasSpawnedFromInventory(bool bInSpawnedFromInventory) { bWasSpawnedFromInventory = bInSpawnedFromInventory; ++SaveStateVersion; }
+
+    /** Increments whenever item, quantity, resting transform or origin change; lets savers skip unchanged pickups. */
+    uint32 GetSaveStateVersion() const { return SaveStateVersion; }
 
     UFUNCTION(BlueprintPure, Category="Pickup|Save")
     FGuid GetPersistentId() const { return PersistentId; }
@@ -88,12 +122,51 @@ public:
     UFUNCTION(BlueprintCallable, Category="Pickup|Save")
     void SetPersistentId(const FGuid& InPersistentId);
 
+    /**
+     * Starts one batched async load for the world meshes of Items so many pickups spawned together (e.g. during a save
+     * restore) share a single request. Keep the returned handle alive until the pickups have been spawned.
+     */
+    static TSharedPtr<FStreamableHandle> PrefetchItemVisuals(const TArray<UItemData*>& Items);
+
     UPROPERTY(BlueprintAssignable, Category="Pickup|Events")
     FItemPickupEvent OnDropSettled;
 
+    /** Broadcast when the pickup leaves the world, either destroyed or returned to the pickup pool. */
     UPROPERTY(BlueprintAssignable, Category="Pickup|Events")
     FItemPickupEvent OnPickupDestroyed;
 
+    /** True while a drop is still simulating and has not broadcast OnDropSettled yet. */
+    UFUNCTION(BlueprintPure, Category="Pickup")
+    bool IsSettling() const { return Dropped; }
+
+    /** Places the pickup at rest at Transform without simulating, as if it had already settled there. Server only. */
+    void RestoreSettled(const FTransform& Transform);
+
+    /** True while the actor is hidden in UItemPickupPoolSubsystem waiting for reuse. */
+    UFUNCTION(BlueprintPure, Category="Pickup|Pool")
+    bool IsPooled() const { return bPooled; }
+
 private:
+    friend class UItemPickupPoolSubsystem;
+
+    /** Hides the pickup, stops physics and timers, clears its save identity and lets it go net dormant. */
+    void DeactivateForPool();
+
+    /** Restores class defaults, assigns InPersistentId (or a fresh one when invalid) and places the pickup at Transform. */
+    void ActivateFromPool(const FTransform& Transform, const FGuid& InPersistentId);
+
+    void ApplyPooledState();
+
+    /** Pushes a state change to clients, flushing net dormancy if the pickup has settled. Server only. */
+    void WakeForReplication();
+    void ApplyRestingCollision();
+
+    UPROPERTY(ReplicatedUsing=OnRep_Pooled)
+    bool bPooled = false;
+
     FTimerHandle DropPhysicsTimerHandle;
+
+    uint32 SaveStateVersion = 0;
+
+    TSharedPtr<FStreamableHandle> VisualLoadHandle;
 };
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ItemPickupMerge.generated.h"
+
+class AItemPickup;
+
+/**
+ * Server-side spatial hash of settled dropped pickups. When a drop settles, its quantity is folded into
+ * nearby pickups of the same item (up to MaxStackSize) so camps do not accumulate one actor per drop.
+ */
+UCLASS()
+class MOINVENTORY_API UItemPickupMergeSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Deinitialize() override;
+
+    /**
+     * Moves as much of Pickup's quantity as fits into settled neighbours holding the same item.
+     * Returns true when Pickup was emptied and released; otherwise Pickup is indexed with its remaining quantity.
+     */
+    bool MergeSettledPickup(AItemPickup* Pickup);
+
+    /** Number of settled pickups currently indexed. */
+    int32 GetIndexedPickupCount() const { return PickupCells.Num(); }
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    UFUNCTION()
+    void HandlePickupRemoved(AItemPickup* Pickup);
+
+    void AddToIndex(AItemPickup* Pickup, float CellSize);
+    void RemoveFromIndex(AItemPickup* Pickup);
+
+    static FIntVector ToCell(const FVector& Location, float CellSize);
+
+    /** Cell -> settled pickups inside it. Cells are MergeRadius wide, so a query only visits the 27 surrounding cells. */
+    TMap<FIntVector, TArray<TWeakObjectPtr<AItemPickup>>> Cells;
+    TMap<TWeakObjectPtr<AItemPickup>, FIntVector> PickupCells;
+
+    /** Cell size the index was built with; changing the radius at runtime rebuilds it lazily. */
+    float IndexedCellSize = 0.f;
+};
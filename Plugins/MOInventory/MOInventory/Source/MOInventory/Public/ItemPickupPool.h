@@ -0,0 +1,105 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Templates/SubclassOf.h"
+#include "ItemPickupPool.generated.h"
+
+class AItemPickup;
+class APawn;
+
+/** Running counters reported by UItemPickupPoolSubsystem. */
+USTRUCT(BlueprintType)
+struct MOINVENTORY_API FItemPickupPoolStats
+{
+    GENERATED_BODY()
+
+    /** Acquires served from a pooled actor. */
+    UPROPERTY(BlueprintReadOnly, Category="Pickup|Pool")
+    int32 Hits = 0;
+
+    /** Acquires that had to spawn a new actor. */
+    UPROPERTY(BlueprintReadOnly, Category="Pickup|Pool")
+    int32 Misses = 0;
+
+    /** Pickups returned to the pool instead of being destroyed. */
+    UPROPERTY(BlueprintReadOnly, Category="Pickup|Pool")
+    int32 Releases = 0;
+
+    /** Pickups destroyed on release because their class bucket was full. */
+    UPROPERTY(BlueprintReadOnly, Category="Pickup|Pool")
+    int32 Overflows = 0;
+
+    /** Actors spawned ahead of time by Prewarm. */
+    UPROPERTY(BlueprintReadOnly, Category="Pickup|Pool")
+    int32 Prewarmed = 0;
+
+    /** Actors currently waiting in the pool across all classes. */
+    UPROPERTY(BlueprintReadOnly, Category="Pickup|Pool")
+    int32 Available = 0;
+};
+
+USTRUCT()
+struct FItemPickupPoolBucket
+{
+    GENERATED_BODY()
+
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<AItemPickup>> Available;
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnItemPickupActivated, AItemPickup*);
+
+/**
+ * Server-side pool of hidden, dormant AItemPickup actors, bucketed per pickup class.
+ * Drops acquire from the pool instead of spawning and picked-up actors are released back instead of destroyed,
+ * which keeps drop-all and looting from churning actors, GC and net channels.
+ */
+UCLASS()
+class MOINVENTORY_API UItemPickupPoolSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Deinitialize() override;
+
+    /** Returns a pooled pickup placed at Transform, spawning a new one when the bucket is empty. Server only. */
+    UFUNCTION(BlueprintCallable, Category="Pickup|Pool")
+    AItemPickup* AcquirePickup(TSubclassOf<AItemPickup> PickupClass, const FTransform& Transform, AActor* PickupOwner = nullptr, APawn* PickupInstigator = nullptr);
+
+    /**
+     * AcquirePickup for a pickup that must keep an existing identity (e.g. restored from a record). PersistentId is in
+     * place before OnPickupActivated or the world's actor-spawned event fires, so listeners see the final id.
+     */
+    AItemPickup* AcquirePickupWithId(TSubclassOf<AItemPickup> PickupClass, const FTransform& Transform, const FGuid& PersistentId, AActor* PickupOwner = nullptr, APawn* PickupInstigator = nullptr);
+
+    /** Hides and deactivates Pickup for reuse, or destroys it when pooling is disabled or its bucket is full. */
+    UFUNCTION(BlueprintCallable, Category="Pickup|Pool")
+    void ReleasePickup(AItemPickup* Pickup);
+
+    /** Tops the bucket for PickupClass up to Count hidden actors. */
+    UFUNCTION(BlueprintCallable, Category="Pickup|Pool")
+    void Prewarm(TSubclassOf<AItemPickup> PickupClass, int32 Count);
+
+    UFUNCTION(BlueprintPure, Category="Pickup|Pool")
+    FItemPickupPoolStats GetStats() const;
+
+    /** Broadcast when a pooled actor re-enters the world; pooled reuse does not raise the world's actor-spawned event. */
+    FOnItemPickupActivated OnPickupActivated;
+
+    /** Releases Pickup through its world's pool, falling back to Destroy. */
+    static void ReleaseOrDestroy(AItemPickup* Pickup);
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    bool CanPool() const;
+    AItemPickup* SpawnPooledPickup(UClass* PickupClass);
+
+    UPROPERTY(Transient)
+    TMap<TObjectPtr<UClass>, FItemPickupPoolBucket> Buckets;
+
+    FItemPickupPoolStats Stats;
+};
@@ -0,0 +1,19 @@
+using UnrealBuildTool;
+
+//MOInventoryTests.Build.cs
+
+
+public class MOInventoryTests : ModuleRules
+{
+    public MOInventoryTests(ReadOnlyTargetRules Target) : base(Target)
+    {
+        PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+        PrivateDependencyModuleNames.AddRange(new[]
+        {
+            "Core", "CoreUObject", "Engine",
+            "MOInventory",
+            "MOItems"
+        });
+    }
+}
@@ -0,0 +1,237 @@
+// Implementation: Microbenchmarks for UInventoryComponent at 24, 256, 4096 and 65536 slots. Each operation is
+// timed over a fixed number of iterations on a half-full inventory and appended to
+// Saved/Automation/InventoryBenchmark.csv (one row per operation and size) so runs before and after an
+// inventory change can be diffed. Sparse-storage runs are tagged "/Sparse" in the Operation column. Filtered as a perf test; run with "Automation RunTests MO56.Inventory.Benchmark".
+#include "InventoryTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+using namespace MOInventoryTests;
+
+namespace
+{
+    const int32 BenchmarkSlotCounts[] = { 24, 256, 4096, 65536 };
+
+    /** Slot-local operations; cheap enough to repeat many times even on the largest inventory. */
+    constexpr int32 SlotOperationIterations = 1000;
+
+    /** Each drop spawns (or recycles) a pickup actor. */
+    constexpr int32 DropIterations = 64;
+
+    /** Whole-inventory operations. */
+    constexpr int32 SaveOperationIterations = 8;
+
+    struct FBenchmarkRow
+    {
+        FString Operation;
+        int32 Slots = 0;
+        int32 Iterations = 0;
+        double TotalSeconds = 0.0;
+    };
+
+    FString GetBenchmarkCsvPath()
+    {
+        return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Automation"), TEXT("InventoryBenchmark.csv"));
+    }
+
+    void AppendRowsToCsv(const TArray<FBenchmarkRow>& Rows)
+    {
+        const FString CsvPath = GetBenchmarkCsvPath();
+        const FString Timestamp = FDateTime::UtcNow().ToIso8601();
+
+        FString Csv;
+        if (!IFileManager::Get().FileExists(*CsvPath))
+        {
+            Csv += TEXT("Timestamp,Operation,Slots,Iterations,TotalMs,MeanUs\n");
+        }
+
+        for (const FBenchmarkRow& Row : Rows)
+        {
+            Csv += FString::Printf(TEXT("%s,%s,%d,%d,%.4f,%.4f\n"),
+                *Timestamp,
+                *Row.Operation,
+                Row.Slots,
+                Row.Iterations,
+                Row.TotalSeconds * 1000.0,
+                Row.Iterations > 0 ? Row.TotalSeconds * 1000000.0 / Row.Iterations : 0.0);
+        }
+
+        FFileHelper::SaveStringToFile(Csv, *CsvPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &IFileManager::Get(), FILEWRITE_Append);
+    }
+
+    /** Every other slot holds a partial stack, alternating between two items; the rest are empty. */
+    FInventorySaveData MakeHalfFullSave(int32 NumSlots, UItemData* ItemA, UItemData* ItemB)
+    {
+        FInventorySaveData Data;
+        Data.MaxSlots = NumSlots;
+        Data.Slots.SetNum(NumSlots);
+        for (int32 Index = 0; Index < NumSlots; Index += 2)
+        {
+            UItemData* Item = (Index / 2) % 2 == 0 ? ItemA : ItemB;
+            Data.Slots[Index].ItemPath = FSoftObjectPath(Item);
+            Data.Slots[Index].Quantity = FMath::Max(2, FInventoryModel::MaxStack(Item) / 2);
+        }
+        return Data;
+    }
+
+    template <typename FunctionType>
+    FBenchmarkRow TimeOperation(const TCHAR* Operation, int32 NumSlots, int32 Iterations, FunctionType&& Function)
+    {
+        const double Start = FPlatformTime::Seconds();
+        for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+            Function(Iteration);
+        }
+
+        FBenchmarkRow Row;
+        Row.Operation = Operation;
+        Row.Slots = NumSlots;
+        Row.Iterations = Iterations;
+        Row.TotalSeconds = FPlatformTime::Seconds() - Start;
+        return Row;
+    }
+}
+
+BEGIN_DEFINE_SPEC(FInventoryBenchmarkSpec, "MO56.Inventory.Benchmark", EAutomationTestFlags::PerfFilter | EAutomationTestFlags_ApplicationContextMask)
+    TUniquePtr<FInventoryTestWorld> TestWorld;
+    TStrongObjectPtr<UItemData> ItemA;
+    TStrongObjectPtr<UItemData> ItemB;
+    int32 PreviousValidateTotals = 0;
+
+    void RunBenchmark(int32 NumSlots, bool bSparse);
+END_DEFINE_SPEC(FInventoryBenchmarkSpec)
+
+void FInventoryBenchmarkSpec::RunBenchmark(int32 NumSlots, bool bSparse)
+{
+    UInventoryComponent* Inventory = TestWorld->SpawnInventory(NumSlots, bSparse);
+    UInventoryComponent* Other = TestWorld->SpawnInventory(NumSlots, bSparse);
+    const FInventorySaveData HalfFull = MakeHalfFullSave(NumSlots, ItemA.Get(), ItemB.Get());
+
+    TArray<FBenchmarkRow> Rows;
+
+    Inventory->ReadFromSaveData(HalfFull);
+    Rows.Add(TimeOperation(TEXT("AddItem"), NumSlots, SlotOperationIterations, [&](int32)
+    {
+        Inventory->AddItem(ItemA.Get(), 1);
+    }));
+
+    Rows.Add(TimeOperation(TEXT("RemoveItem"), NumSlots, SlotOperationIterations, [&](int32)
+    {
+        Inventory->RemoveItem(ItemA.Get(), 1);
+    }));
+
+    Inventory->ReadFromSaveData(HalfFull);
+    Rows.Add(TimeOperation(TEXT("SplitStackAtIndex"), NumSlots, SlotOperationIterations, [&](int32 Iteration)
+    {
+        // Stacks live on even slots; splits land in the first free (odd) slot.
+        Inventory->SplitStackAtIndex((2 * Iteration) % NumSlots);
+    }));
+
+    Inventory->ReadFromSaveData(HalfFull);
+    Rows.Add(TimeOperation(TEXT("TransferItemBetweenSlots"), NumSlots, SlotOperationIterations, [&](int32 Iteration)
+    {
+        // Move a stack into the empty slot next to it; every other iteration moves it back.
+        const int32 Pair = (Iteration / 2) % FMath::Max(1, NumSlots / 2);
+        const int32 Occupied = 2 * Pair;
+        const int32 Empty = FMath::Min(Occupied + 1, NumSlots - 1);
+        if (Iteration % 2 == 0)
+        {
+            Inventory->TransferItemBetweenSlots(Occupied, Empty);
+        }
+        else
+        {
+            Inventory->TransferItemBetweenSlots(Empty, Occupied);
+        }
+    }));
+
+    Inventory->ReadFromSaveData(HalfFull);
+    Other->ReadFromSaveData(FInventorySaveData());
+    Rows.Add(TimeOperation(TEXT("TransferItemToInventory"), NumSlots, SlotOperationIterations, [&](int32 Iteration)
+    {
+        const int32 Slot = (2 * Iteration) % NumSlots;
+        Inventory->TransferItemToInventory(Other, Slot, Slot);
+    }));
+
+    Inventory->ReadFromSaveData(HalfFull);
+    Rows.Add(TimeOperation(TEXT("DropItemAtIndex"), NumSlots, DropIterations, [&](int32 Iteration)
+    {
+        Inventory->DropItemAtIndex((2 * Iteration) % NumSlots);
+    }));
+
+    Rows.Add(TimeOperation(TEXT("ReadFromSaveData"), NumSlots, SaveOperationIterations, [&](int32)
+    {
+        Inventory->ReadFromSaveData(HalfFull);
+    }));
+
+    FInventorySaveData Written;
+    Rows.Add(TimeOperation(TEXT("WriteToSaveData"), NumSlots, SaveOperationIterations, [&](int32)
+    {
+        Inventory->WriteToSaveData(Written);
+    }));
+
+    for (FBenchmarkRow& Row : Rows)
+    {
+        if (bSparse)
+        {
+            Row.Operation += TEXT("/Sparse");
+        }
+
+        AddInfo(FString::Printf(TEXT("%s @ %d slots: %.3f ms total, %.3f us/op"), *Row.Operation, Row.Slots,
+            Row.TotalSeconds * 1000.0, Row.Iterations > 0 ? Row.TotalSeconds * 1000000.0 / Row.Iterations : 0.0));
+    }
+
+    AppendRowsToCsv(Rows);
+}
+
+void FInventoryBenchmarkSpec::Define()
+{
+    BeforeEach([this]()
+    {
+        TestWorld = MakeUnique<FInventoryTestWorld>();
+        ItemA = MakeTestItem(TEXT("BenchItem_A"), 50, 0.2f, 0.001f);
+        ItemB = MakeTestItem(TEXT("BenchItem_B"), 20, 1.f, 0.004f);
+
+        // The totals cross-check walks every slot on each broadcast; keep it out of the timings whatever it is set to.
+        if (IConsoleVariable* Validate = IConsoleManager::Get().FindConsoleVariable(TEXT("MO56.Inventory.ValidateTotals")))
+        {
+            PreviousValidateTotals = Validate->GetInt();
+            Validate->Set(0, ECVF_SetByCode);
+        }
+    });
+
+    AfterEach([this]()
+    {
+        if (IConsoleVariable* Validate = IConsoleManager::Get().FindConsoleVariable(TEXT("MO56.Inventory.ValidateTotals")))
+        {
+            Validate->Set(PreviousValidateTotals, ECVF_SetByCode);
+        }
+
+        TestWorld.Reset();
+        ItemA.Reset();
+        ItemB.Reset();
+    });
+
+    for (const int32 NumSlots : BenchmarkSlotCounts)
+    {
+        It(FString::Printf(TEXT("times inventory operations at %d slots"), NumSlots), [this, NumSlots]()
+        {
+            RunBenchmark(NumSlots, false);
+            AddInfo(FString::Printf(TEXT("Results appended to %s"), *GetBenchmarkCsvPath()));
+        });
+
+        It(FString::Printf(TEXT("times inventory operations at %d slots with sparse storage"), NumSlots), [this, NumSlots]()
+        {
+            RunBenchmark(NumSlots, true);
+            AddInfo(FString::Printf(TEXT("Results appended to %s"), *GetBenchmarkCsvPath()));
+        });
+    }
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,34 @@
+// Implementation: Listener object for the inventory specs. OnInventoryChanged is a dynamic delegate and can only
+// be bound to a UFUNCTION, so specs watch an inventory through this recorder and inspect the change sets it
+// received to check when, and how often, notifications were sent.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InventoryComponent.h"
+#include "UObject/Object.h"
+#include "InventoryChangeRecorder.generated.h"
+
+UCLASS(Transient)
+class UInventoryChangeRecorder : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    void Watch(UInventoryComponent* Inventory)
+    {
+        if (Inventory)
+        {
+            Inventory->OnInventoryChanged.AddDynamic(this, &UInventoryChangeRecorder::HandleInventoryChanged);
+        }
+    }
+
+    /** Every change set received, oldest first. */
+    TArray<FInventoryChangeSet> ChangeSets;
+
+private:
+    UFUNCTION()
+    void HandleInventoryChanged(const FInventoryChangeSet& ChangeSet)
+    {
+        ChangeSets.Add(ChangeSet);
+    }
+};
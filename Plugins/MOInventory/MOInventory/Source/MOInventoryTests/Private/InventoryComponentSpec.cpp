@@ -0,0 +1,486 @@
+// Implementation: Invariant suite for UInventoryComponent. Seeded random sequences of AddItem, RemoveItem,
+// SplitStackAtIndex, TransferItemBetweenSlots, TransferItemToInventory, DropItemAtIndex and ReadFromSaveData
+// run against two live inventories and FInventoryModel; after every step the slots, stack caps, cached
+// totals and the units held by dropped pickups must agree with the model, with dense and sparse slot storage.
+// Directed cases cover transaction nesting, all-or-nothing command batches across two inventories and TakeAll.
+#include "InventoryTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "InventoryChangeRecorder.h"
+#include "ItemPickup.h"
+#include "Math/RandomStream.h"
+
+using namespace MOInventoryTests;
+
+namespace
+{
+    constexpr int32 FuzzSeedCount = 8;
+    constexpr int32 FuzzStepsPerSeed = 400;
+
+    int32 CountDroppedUnits(UWorld* World)
+    {
+        int32 Units = 0;
+        for (TActorIterator<AItemPickup> It(World); It; ++It)
+        {
+            if (!It->IsPooled() && It->GetItem())
+            {
+                Units += It->GetQuantity();
+            }
+        }
+        return Units;
+    }
+}
+
+BEGIN_DEFINE_SPEC(FInventoryComponentSpec, "MO56.Inventory.Component", EAutomationTestFlags::ProductFilter | EAutomationTestFlags_ApplicationContextMask)
+    TUniquePtr<FInventoryTestWorld> TestWorld;
+    TArray<TStrongObjectPtr<UItemData>> ItemHandles;
+    TArray<UItemData*> Items;
+    TMap<FSoftObjectPath, UItemData*> ItemsByPath;
+    int32 PreviousValidateTotals = 0;
+
+    FInventorySaveData MakeRandomSaveData(FRandomStream& Random, int32 NumSlots) const;
+END_DEFINE_SPEC(FInventoryComponentSpec)
+
+FInventorySaveData FInventoryComponentSpec::MakeRandomSaveData(FRandomStream& Random, int32 NumSlots) const
+{
+    FInventorySaveData Data;
+    Data.MaxSlots = NumSlots;
+
+    // Deliberately uneven: short or long slot lists, empty paths, zero/negative and over-cap quantities.
+    // Half the saves tag entries with slot indices, including duplicates and out-of-range ones.
+    const bool bTagged = Random.FRand() < 0.5f;
+    const int32 SavedSlots = Random.RandRange(0, NumSlots + 4);
+    Data.Slots.SetNum(SavedSlots);
+    for (FInventorySlotSaveData& Slot : Data.Slots)
+    {
+        if (bTagged)
+        {
+            Slot.SlotIndex = Random.RandRange(-1, NumSlots + 1);
+        }
+
+        if (Random.FRand() < 0.3f)
+        {
+            continue;
+        }
+
+        UItemData* Item = Items[Random.RandRange(0, Items.Num() - 1)];
+        Slot.ItemPath = FSoftObjectPath(Item);
+        Slot.Quantity = Random.RandRange(-2, FInventoryModel::MaxStack(Item) + 3);
+    }
+
+    return Data;
+}
+
+void FInventoryComponentSpec::Define()
+{
+    BeforeEach([this]()
+    {
+        TestWorld = MakeUnique<FInventoryTestWorld>();
+
+        ItemHandles.Reset();
+        ItemHandles.Add(MakeTestItem(TEXT("TestItem_Single"), 1, 2.5f, 0.01f));
+        ItemHandles.Add(MakeTestItem(TEXT("TestItem_Five"), 5, 0.4f, 0.002f));
+        ItemHandles.Add(MakeTestItem(TEXT("TestItem_Twenty"), 20, 0.1f, 0.0005f));
+        ItemHandles.Add(MakeTestItem(TEXT("TestItem_Bulk"), 99, 0.05f, 0.0001f));
+
+        Items.Reset();
+        ItemsByPath.Reset();
+        for (const TStrongObjectPtr<UItemData>& Handle : ItemHandles)
+        {
+            Items.Add(Handle.Get());
+            ItemsByPath.Add(FSoftObjectPath(Handle.Get()), Handle.Get());
+        }
+
+        // Let the component cross-check its running totals after every change it broadcasts as well.
+        if (IConsoleVariable* Validate = IConsoleManager::Get().FindConsoleVariable(TEXT("MO56.Inventory.ValidateTotals")))
+        {
+            PreviousValidateTotals = Validate->GetInt();
+            Validate->Set(1, ECVF_SetByCode);
+        }
+    });
+
+    AfterEach([this]()
+    {
+        if (IConsoleVariable* Validate = IConsoleManager::Get().FindConsoleVariable(TEXT("MO56.Inventory.ValidateTotals")))
+        {
+            Validate->Set(PreviousValidateTotals, ECVF_SetByCode);
+        }
+
+        TestWorld.Reset();
+        Items.Reset();
+        ItemsByPath.Reset();
+        ItemHandles.Reset();
+    });
+
+    Describe("Stacking", [this]()
+    {
+        It("fills existing stacks before empty slots and respects the stack cap", [this]()
+        {
+            UInventoryComponent* Inventory = TestWorld->SpawnInventory(4);
+            FInventoryModel Model(4);
+            UItemData* Twenty = Items[2];
+
+            TestEqual(TEXT("First add"), Inventory->AddItem(Twenty, 15), Model.AddItem(Twenty, 15));
+            TestEqual(TEXT("Second add"), Inventory->AddItem(Twenty, 30), Model.AddItem(Twenty, 30));
+            TestEqual(TEXT("Overflow add"), Inventory->AddItem(Twenty, 100), Model.AddItem(Twenty, 100));
+            TestEqual(TEXT("Inventory holds exactly four full stacks"), Inventory->CountItem(Twenty), 80);
+            VerifyInventory(*this, *Inventory, Model, Items, TEXT("Stacking"));
+        });
+
+        It("rejects a split when no slot is free", [this]()
+        {
+            UInventoryComponent* Inventory = TestWorld->SpawnInventory(2);
+            FInventoryModel Model(2);
+
+            Inventory->AddItem(Items[1], 10);
+            Model.AddItem(Items[1], 10);
+
+            TestFalse(TEXT("Split without space"), Inventory->SplitStackAtIndex(0));
+            VerifyInventory(*this, *Inventory, Model, Items, TEXT("Split without space"));
+        });
+
+        It("clamps loaded quantities to the stack cap", [this]()
+        {
+            UInventoryComponent* Inventory = TestWorld->SpawnInventory(3);
+            FInventoryModel Model(3);
+
+            FInventorySaveData Data;
+            Data.MaxSlots = 3;
+            Data.Slots.SetNum(2);
+            Data.Slots[0].ItemPath = FSoftObjectPath(Items[1]);
+            Data.Slots[0].Quantity = 50;
+            Data.Slots[1].ItemPath = FSoftObjectPath(Items[0]);
+            Data.Slots[1].Quantity = -4;
+
+            Inventory->ReadFromSaveData(Data);
+            Model.ReadFromSaveData(Data, ItemsByPath);
+
+            TestEqual(TEXT("Over-cap quantity clamped"), Inventory->GetSlots()[0].Quantity, 5);
+            VerifyInventory(*this, *Inventory, Model, Items, TEXT("ReadFromSaveData clamp"));
+        });
+    });
+
+    Describe("Sparse storage", [this]()
+    {
+        It("stores and saves only occupied slots", [this]()
+        {
+            UInventoryComponent* Inventory = TestWorld->SpawnInventory(10000, true);
+            FInventoryModel Model(10000);
+
+            Inventory->AddItem(Items[1], 12);
+            Model.AddItem(Items[1], 12);
+            Inventory->TransferItemBetweenSlots(1, 9000);
+            Model.Move(1, 9000);
+
+            TestTrue(TEXT("Uses sparse storage"), Inventory->UsesSparseStorage());
+            TestEqual(TEXT("Slot count"), Inventory->GetNumSlots(), 10000);
+            TestEqual(TEXT("Stored entries"), Inventory->GetStoredSlots().Num(), 3);
+
+            TArray<FItemStack> Page;
+            Inventory->GetSlotPage(8990, 20, Page);
+            TestEqual(TEXT("Page size"), Page.Num(), 20);
+            TestEqual(TEXT("Page holds the moved stack"), Page[10].Quantity, Model.Slots[9000].Quantity);
+            TestEqual(TEXT("Page entries carry their slot"), Page[10].SlotIndex, 9000);
+
+            FInventorySaveData Saved;
+            Inventory->WriteToSaveData(Saved);
+            TestEqual(TEXT("Saved entries"), Saved.Slots.Num(), 3);
+            TestEqual(TEXT("Saved slot index"), Saved.Slots.Last().SlotIndex, 9000);
+
+            UInventoryComponent* Dense = TestWorld->SpawnInventory(10000);
+            Dense->ReadFromSaveData(Saved);
+            VerifyInventory(*this, *Dense, Model, Items, TEXT("Sparse save into dense inventory"));
+
+            Inventory->ReadFromSaveData(Saved);
+            VerifyInventory(*this, *Inventory, Model, Items, TEXT("Sparse save round trip"));
+        });
+    });
+
+    Describe("Physical properties", [this]()
+    {
+        It("falls back to the overrides for un-baked items and keeps the totals exact", [this]()
+        {
+            AddExpectedMessage(TEXT("has no baked physical properties"), ELogVerbosity::Warning, EAutomationExpectedMessageFlags::Contains, 1, false);
+
+            TStrongObjectPtr<UItemData> Unbaked = MakeTestItem(TEXT("TestItem_Unbaked"), 10, 0.75f, 0.003f, false);
+            TestFalse(TEXT("Item is un-baked"), Unbaked->bHasBakedPhysicalProperties);
+            TestEqual(TEXT("Fallback weight"), Unbaked->GetWeightKg(), 0.75f);
+            TestEqual(TEXT("Fallback volume"), Unbaked->GetVolumeCubicMeters(), 0.003f);
+
+            UInventoryComponent* Inventory = TestWorld->SpawnInventory(4);
+            Inventory->AddItem(Unbaked.Get(), 14);
+            Inventory->AddItem(Items[2], 5);
+            TestEqual(TEXT("Total weight"), Inventory->GetTotalWeight(), 14 * 0.75f + 5 * 0.1f, 1.0e-4f);
+            TestEqual(TEXT("Total volume"), Inventory->GetTotalVolume(), 14 * 0.003f + 5 * 0.0005f, 1.0e-6f);
+
+            Inventory->RemoveItem(Unbaked.Get(), 14);
+            Inventory->RemoveItem(Items[2], 5);
+            TestEqual(TEXT("Weight returns to zero"), Inventory->GetTotalWeight(), 0.f, 1.0e-4f);
+            TestEqual(TEXT("Volume returns to zero"), Inventory->GetTotalVolume(), 0.f, 1.0e-6f);
+        });
+    });
+
+    Describe("Change versions", [this]()
+    {
+        It("advances the content version only when contents change", [this]()
+        {
+            UInventoryComponent* Inventory = TestWorld->SpawnInventory(4);
+            const uint32 Initial = Inventory->GetContentVersion();
+
+            Inventory->CountItem(Items[1]);
+            Inventory->GetSlots();
+            TestEqual(TEXT("Queries leave the version alone"), Inventory->GetContentVersion(), Initial);
+
+            Inventory->AddItem(Items[1], 3);
+            const uint32 AfterAdd = Inventory->GetContentVersion();
+            TestNotEqual(TEXT("Add advances the version"), AfterAdd, Initial);
+
+            FInventorySaveData Saved;
+            Inventory->WriteToSaveData(Saved);
+            TestEqual(TEXT("Saving leaves the version alone"), Inventory->GetContentVersion(), AfterAdd);
+
+            Inventory->RemoveItem(Items[1], 1);
+            TestNotEqual(TEXT("Remove advances the version"), Inventory->GetContentVersion(), AfterAdd);
+        });
+    });
+
+    Describe("Transactions", [this]()
+    {
+        It("holds notifications until the outermost transaction commits", [this]()
+        {
+            UInventoryComponent* Inventory = TestWorld->SpawnInventory(4);
+            TStrongObjectPtr<UInventoryChangeRecorder> Recorder(NewObject<UInventoryChangeRecorder>());
+            Recorder->Watch(Inventory);
+
+            {
+                FInventoryTransaction Outer(Inventory);
+                Inventory->AddItem(Items[1], 3);
+                {
+                    FInventoryTransaction Inner(Inventory);
+                    Inventory->AddItem(Items[2], 4);
+                }
+
+                TestTrue(TEXT("Still inside the outer transaction"), Inventory->IsInTransaction());
+                TestEqual(TEXT("Inner commit sends nothing"), Recorder->ChangeSets.Num(), 0);
+                Inventory->AddItem(Items[0], 1);
+            }
+
+            TestFalse(TEXT("Outer commit closes the transaction"), Inventory->IsInTransaction());
+            if (TestEqual(TEXT("One notification for the whole transaction"), Recorder->ChangeSets.Num(), 1))
+            {
+                TestTrue(TEXT("Change set lists every touched slot"), Recorder->ChangeSets[0].SlotIndices == TArray<int32>({ 0, 1, 2 }));
+            }
+
+            {
+                FInventoryTransaction Unchanged(Inventory);
+                Inventory->RemoveItem(Items[3], 1);
+            }
+            TestEqual(TEXT("A transaction without changes stays silent"), Recorder->ChangeSets.Num(), 1);
+        });
+    });
+
+    Describe("Command batches", [this]()
+    {
+        It("rolls back both inventories when a later command fails", [this]()
+        {
+            UInventoryComponent* Inventory = TestWorld->SpawnInventory(4);
+            UInventoryComponent* Other = TestWorld->SpawnInventory(4, true);
+            FInventoryModel Model(4);
+            FInventoryModel OtherModel(4);
+
+            Inventory->AddItem(Items[1], 7);
+            Model.AddItem(Items[1], 7);
+            Inventory->AddItem(Items[0], 1);
+            Model.AddItem(Items[0], 1);
+            Other->AddItem(Items[2], 10);
+            OtherModel.AddItem(Items[2], 10);
+
+            const int32 DroppedBefore = CountDroppedUnits(TestWorld->GetWorld());
+
+            TArray<FInventoryCommand> Commands;
+            FInventoryCommand& Transfer = Commands.AddDefaulted_GetRef();
+            Transfer.Type = EInventoryCommandType::TransferToInventory;
+            Transfer.SourceSlot = 0;
+            Transfer.TargetSlot = 1;
+            Transfer.OtherInventory = Other;
+            FInventoryCommand& Drop = Commands.AddDefaulted_GetRef();
+            Drop.Type = EInventoryCommandType::Drop;
+            Drop.SourceSlot = 2;
+            FInventoryCommand& TakeAll = Commands.AddDefaulted_GetRef();
+            TakeAll.Type = EInventoryCommandType::TakeAll;
+            TakeAll.OtherInventory = Other;
+            FInventoryCommand& Invalid = Commands.AddDefaulted_GetRef();
+            Invalid.Type = EInventoryCommandType::Move;
+            Invalid.SourceSlot = INDEX_NONE;
+            Invalid.TargetSlot = 0;
+
+            Inventory->SubmitCommands(Commands);
+            VerifyInventory(*this, *Inventory, Model, Items, TEXT("Rejected batch [inventory]"));
+            VerifyInventory(*this, *Other, OtherModel, Items, TEXT("Rejected batch [other]"));
+            TestEqual(TEXT("Rejected batch spawns no pickups"), CountDroppedUnits(TestWorld->GetWorld()), DroppedBefore);
+
+            // Without the failing command the same batch applies in full.
+            Commands.Pop();
+            Inventory->SubmitCommands(Commands);
+            FInventoryModel::Transfer(Model, 0, OtherModel, 1);
+            const int32 Dropped = Model.Drop(2);
+            FInventoryModel::TakeAll(OtherModel, Model);
+            VerifyInventory(*this, *Inventory, Model, Items, TEXT("Accepted batch [inventory]"));
+            VerifyInventory(*this, *Other, OtherModel, Items, TEXT("Accepted batch [other]"));
+            TestEqual(TEXT("Accepted batch drops its pickup"), CountDroppedUnits(TestWorld->GetWorld()), DroppedBefore + Dropped);
+        });
+    });
+
+    Describe("Take all", [this]()
+    {
+        It("moves what fits between inventories and notifies each once", [this]()
+        {
+            UInventoryComponent* Target = TestWorld->SpawnInventory(3);
+            UInventoryComponent* Source = TestWorld->SpawnInventory(6, true);
+            FInventoryModel TargetModel(3);
+            FInventoryModel SourceModel(6);
+
+            Target->AddItem(Items[2], 15);
+            TargetModel.AddItem(Items[2], 15);
+            Target->AddItem(Items[0], 1);
+            TargetModel.AddItem(Items[0], 1);
+            Source->AddItem(Items[2], 30);
+            SourceModel.AddItem(Items[2], 30);
+            Source->AddItem(Items[1], 12);
+            SourceModel.AddItem(Items[1], 12);
+
+            TStrongObjectPtr<UInventoryChangeRecorder> TargetRecorder(NewObject<UInventoryChangeRecorder>());
+            TStrongObjectPtr<UInventoryChangeRecorder> SourceRecorder(NewObject<UInventoryChangeRecorder>());
+            TargetRecorder->Watch(Target);
+            SourceRecorder->Watch(Source);
+
+            TestEqual(TEXT("Units moved"), Target->TakeAllFromInventory(Source), FInventoryModel::TakeAll(SourceModel, TargetModel));
+            VerifyInventory(*this, *Target, TargetModel, Items, TEXT("TakeAll [target]"));
+            VerifyInventory(*this, *Source, SourceModel, Items, TEXT("TakeAll [source]"));
+            TestEqual(TEXT("Target notified once"), TargetRecorder->ChangeSets.Num(), 1);
+            TestEqual(TEXT("Source notified once"), SourceRecorder->ChangeSets.Num(), 1);
+
+            TestEqual(TEXT("Nothing fits a full target"), Target->TakeAllFromInventory(Source), 0);
+            TestEqual(TEXT("A no-op TakeAll stays silent"), TargetRecorder->ChangeSets.Num(), 1);
+        });
+    });
+
+    Describe("Fuzzing against a reference model", [this]()
+    {
+        It("keeps slots, stack caps, totals and dropped units consistent", [this]()
+        {
+            for (int32 Seed = 1; Seed <= FuzzSeedCount; ++Seed)
+            {
+                FRandomStream Random(Seed);
+                const int32 PrimarySlots = Random.RandRange(4, 32);
+                const int32 SecondarySlots = Random.RandRange(2, 16);
+
+                // Odd seeds run on sparse storage so both layouts see the same operation mix.
+                const bool bSparse = Seed % 2 == 1;
+                UInventoryComponent* Primary = TestWorld->SpawnInventory(PrimarySlots, bSparse);
+                UInventoryComponent* Secondary = TestWorld->SpawnInventory(SecondarySlots, !bSparse);
+                FInventoryModel PrimaryModel(PrimarySlots);
+                FInventoryModel SecondaryModel(SecondarySlots);
+
+                int32 ExpectedDroppedUnits = CountDroppedUnits(TestWorld->GetWorld());
+
+                for (int32 Step = 0; Step < FuzzStepsPerSeed; ++Step)
+                {
+                    const bool bOnPrimary = Random.FRand() < 0.7f;
+                    UInventoryComponent* Inventory = bOnPrimary ? Primary : Secondary;
+                    FInventoryModel& Model = bOnPrimary ? PrimaryModel : SecondaryModel;
+                    UInventoryComponent* Other = bOnPrimary ? Secondary : Primary;
+                    FInventoryModel& OtherModel = bOnPrimary ? SecondaryModel : PrimaryModel;
+
+                    UItemData* Item = Items[Random.RandRange(0, Items.Num() - 1)];
+                    // Indices occasionally fall outside the inventory to cover rejection paths.
+                    const int32 SlotA = Random.RandRange(-1, Model.Slots.Num());
+                    const int32 SlotB = Random.RandRange(-1, Model.Slots.Num());
+                    const int32 OtherSlot = Random.RandRange(-1, OtherModel.Slots.Num());
+
+                    FString Operation;
+                    bool bResultsMatch = true;
+
+                    switch (Random.RandRange(0, 7))
+                    {
+                    case 0:
+                    case 1:
+                    {
+                        const int32 Count = Random.RandRange(1, 3 * FInventoryModel::MaxStack(Item));
+                        Operation = FString::Printf(TEXT("AddItem(%s, %d)"), *Item->GetName(), Count);
+                        bResultsMatch = Inventory->AddItem(Item, Count) == Model.AddItem(Item, Count);
+                        break;
+                    }
+                    case 2:
+                    {
+                        const int32 Count = Random.RandRange(1, 2 * FInventoryModel::MaxStack(Item));
+                        Operation = FString::Printf(TEXT("RemoveItem(%s, %d)"), *Item->GetName(), Count);
+                        bResultsMatch = Inventory->RemoveItem(Item, Count) == Model.RemoveItem(Item, Count);
+                        break;
+                    }
+                    case 3:
+                        Operation = FString::Printf(TEXT("SplitStackAtIndex(%d)"), SlotA);
+                        bResultsMatch = Inventory->SplitStackAtIndex(SlotA) == Model.Split(SlotA);
+                        break;
+                    case 4:
+                        Operation = FString::Printf(TEXT("TransferItemBetweenSlots(%d, %d)"), SlotA, SlotB);
+                        bResultsMatch = Inventory->TransferItemBetweenSlots(SlotA, SlotB) == Model.Move(SlotA, SlotB);
+                        break;
+                    case 5:
+                        Operation = FString::Printf(TEXT("TransferItemToInventory(%d -> %d)"), SlotA, OtherSlot);
+                        bResultsMatch = Inventory->TransferItemToInventory(Other, SlotA, OtherSlot) == FInventoryModel::Transfer(Model, SlotA, OtherModel, OtherSlot);
+                        break;
+                    case 6:
+                    {
+                        Operation = FString::Printf(TEXT("DropItemAtIndex(%d)"), SlotA);
+                        const int32 Dropped = Model.Drop(SlotA);
+                        bResultsMatch = Inventory->DropItemAtIndex(SlotA) == (Dropped > 0);
+                        ExpectedDroppedUnits += Dropped;
+                        break;
+                    }
+                    default:
+                    {
+                        // Loads are rarer than edits, mirroring play; they reset the whole inventory.
+                        if (Random.FRand() < 0.5f)
+                        {
+                            Operation = TEXT("no-op");
+                            break;
+                        }
+
+                        const FInventorySaveData Data = MakeRandomSaveData(Random, Model.Slots.Num());
+                        Operation = FString::Printf(TEXT("ReadFromSaveData(%d saved slots)"), Data.Slots.Num());
+                        Inventory->ReadFromSaveData(Data);
+                        Model.ReadFromSaveData(Data, ItemsByPath);
+                        break;
+                    }
+                    }
+
+                    const FString Context = FString::Printf(TEXT("Seed %d step %d %s on %s"), Seed, Step, *Operation, bOnPrimary ? TEXT("primary") : TEXT("secondary"));
+                    if (!bResultsMatch)
+                    {
+                        AddError(FString::Printf(TEXT("%s: return value disagrees with the model"), *Context));
+                        return;
+                    }
+
+                    if (!VerifyInventory(*this, *Primary, PrimaryModel, Items, Context + TEXT(" [primary]"))
+                        || !VerifyInventory(*this, *Secondary, SecondaryModel, Items, Context + TEXT(" [secondary]")))
+                    {
+                        return;
+                    }
+
+                    const int32 DroppedUnits = CountDroppedUnits(TestWorld->GetWorld());
+                    if (DroppedUnits != ExpectedDroppedUnits)
+                    {
+                        AddError(FString::Printf(TEXT("%s: pickups hold %d units, expected %d"), *Context, DroppedUnits, ExpectedDroppedUnits));
+                        return;
+                    }
+                }
+            }
+        });
+    });
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,429 @@
+// Implementation: Shared fixtures for the inventory specs: a throwaway game world that can host inventory
+// owners and dropped pickups, transient item definitions, and a plain-array reference model that mirrors
+// the documented UInventoryComponent rules so fuzzed operation sequences can be checked slot by slot.
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "InventoryComponent.h"
+#include "ItemData.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+
+namespace MOInventoryTests
+{
+    /** Standalone game world; spawned actors have authority, so drops and mutations run the server path. */
+    class FInventoryTestWorld
+    {
+    public:
+        FInventoryTestWorld()
+        {
+            World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("MOInventoryTestWorld"));
+            FWorldContext& Context = GEngine->CreateNewWorldContext(EWorldType::Game);
+            Context.SetCurrentWorld(World);
+
+            World->InitializeActorsForPlay(FURL());
+            World->BeginPlay();
+        }
+
+        ~FInventoryTestWorld()
+        {
+            GEngine->DestroyWorldContext(World);
+            World->DestroyWorld(false);
+        }
+
+        FInventoryTestWorld(const FInventoryTestWorld&) = delete;
+        FInventoryTestWorld& operator=(const FInventoryTestWorld&) = delete;
+
+        UInventoryComponent* SpawnInventory(int32 NumSlots, bool bSparseStorage = false) const
+        {
+            AActor* Owner = World->SpawnActor<AActor>();
+            UInventoryComponent* Inventory = NewObject<UInventoryComponent>(Owner);
+            Inventory->MaxSlots = NumSlots;
+            Inventory->bSparseSlotStorage = bSparseStorage;
+            Inventory->RegisterComponent();
+
+            // Slot storage is sized lazily; an empty save applies the new MaxSlots without touching contents.
+            FInventorySaveData Empty;
+            Empty.MaxSlots = NumSlots;
+            Inventory->ReadFromSaveData(Empty);
+            return Inventory;
+        }
+
+        UWorld* GetWorld() const { return World; }
+
+    private:
+        UWorld* World = nullptr;
+    };
+
+    /**
+     * Transient item definition kept alive for the lifetime of the owning test. Baked like a saved asset by default;
+     * pass bBaked = false to exercise the runtime fallback for assets saved before baking existed.
+     */
+    inline TStrongObjectPtr<UItemData> MakeTestItem(const TCHAR* Name, int32 MaxStackSize, float WeightKg, float VolumeM3, bool bBaked = true)
+    {
+        UItemData* Item = NewObject<UItemData>(GetTransientPackage(), MakeUniqueObjectName(GetTransientPackage(), UItemData::StaticClass(), Name));
+        Item->MaxStackSize = MaxStackSize;
+        Item->WeightKgOverride = WeightKg;
+        Item->VolumeOverride = VolumeM3;
+
+        if (bBaked)
+        {
+            Item->BakedPhysicalProperties.WeightKg = WeightKg;
+            Item->BakedPhysicalProperties.VolumeM3 = VolumeM3;
+            Item->BakedPhysicalProperties.Density = VolumeM3 > KINDA_SMALL_NUMBER ? WeightKg / VolumeM3 : 0.f;
+            Item->bHasBakedPhysicalProperties = true;
+        }
+
+        return TStrongObjectPtr<UItemData>(Item);
+    }
+
+    struct FModelSlot
+    {
+        UItemData* Item = nullptr;
+        int32 Quantity = 0;
+
+        bool IsEmpty() const { return Item == nullptr || Quantity <= 0; }
+    };
+
+    /** Reference implementation of the slot rules, written for clarity rather than speed. */
+    struct FInventoryModel
+    {
+        TArray<FModelSlot> Slots;
+
+        explicit FInventoryModel(int32 NumSlots)
+        {
+            Slots.SetNum(FMath::Max(1, NumSlots));
+        }
+
+        static int32 MaxStack(const UItemData* Item)
+        {
+            return Item ? FMath::Max(1, Item->MaxStackSize) : 0;
+        }
+
+        void Set(int32 Index, UItemData* Item, int32 Quantity)
+        {
+            Slots[Index].Item = Quantity > 0 ? Item : nullptr;
+            Slots[Index].Quantity = Slots[Index].Item ? Quantity : 0;
+        }
+
+        int32 Count(const UItemData* Item) const
+        {
+            int32 Total = 0;
+            for (const FModelSlot& Slot : Slots)
+            {
+                Total += Slot.Item == Item ? Slot.Quantity : 0;
+            }
+            return Total;
+        }
+
+        int32 TotalUnits() const
+        {
+            int32 Total = 0;
+            for (const FModelSlot& Slot : Slots)
+            {
+                Total += Slot.Quantity;
+            }
+            return Total;
+        }
+
+        /** Tops up existing stacks in slot order, then fills empty slots in slot order. */
+        int32 AddItem(UItemData* Item, int32 Count)
+        {
+            if (!Item || Count <= 0)
+            {
+                return 0;
+            }
+
+            const int32 Max = MaxStack(Item);
+            int32 Remaining = Count;
+
+            for (int32 Index = 0; Index < Slots.Num() && Remaining > 0; ++Index)
+            {
+                if (Slots[Index].Item == Item && Slots[Index].Quantity < Max)
+                {
+                    const int32 ToAdd = FMath::Min(Max - Slots[Index].Quantity, Remaining);
+                    Set(Index, Item, Slots[Index].Quantity + ToAdd);
+                    Remaining -= ToAdd;
+                }
+            }
+
+            Remaining -= AddToEmptySlots(Item, Remaining);
+            return Count - Remaining;
+        }
+
+        int32 AddToEmptySlots(UItemData* Item, int32 Count)
+        {
+            const int32 Max = MaxStack(Item);
+            int32 Added = 0;
+            for (int32 Index = 0; Index < Slots.Num() && Count > 0; ++Index)
+            {
+                if (Slots[Index].IsEmpty())
+                {
+                    const int32 ToAdd = FMath::Min(Max, Count);
+                    Set(Index, Item, ToAdd);
+                    Added += ToAdd;
+                    Count -= ToAdd;
+                }
+            }
+            return Added;
+        }
+
+        int32 RemoveItem(UItemData* Item, int32 Count)
+        {
+            if (!Item || Count <= 0)
+            {
+                return 0;
+            }
+
+            int32 Removed = 0;
+            for (int32 Index = 0; Index < Slots.Num() && Count > 0; ++Index)
+            {
+                if (Slots[Index].Item == Item)
+                {
+                    const int32 ToRemove = FMath::Min(Slots[Index].Quantity, Count);
+                    Set(Index, Item, Slots[Index].Quantity - ToRemove);
+                    Removed += ToRemove;
+                    Count -= ToRemove;
+                }
+            }
+            return Removed;
+        }
+
+        /** Moves half of a stack into the first empty slot; fails without changes when there is none. */
+        bool Split(int32 Index)
+        {
+            if (!Slots.IsValidIndex(Index) || Slots[Index].IsEmpty() || Slots[Index].Quantity <= 1)
+            {
+                return false;
+            }
+
+            const FModelSlot Source = Slots[Index];
+            const int32 Amount = FMath::Max(1, Source.Quantity / 2);
+            Set(Index, Source.Item, Source.Quantity - Amount);
+
+            const int32 Added = AddToEmptySlots(Source.Item, Amount);
+            if (Added != Amount)
+            {
+                Set(Index, Source.Item, Source.Quantity - Added);
+                return false;
+            }
+
+            return true;
+        }
+
+        /** TransferItemBetweenSlots: move into empty, merge into same item, otherwise swap. */
+        bool Move(int32 SourceIndex, int32 TargetIndex)
+        {
+            if (SourceIndex == TargetIndex || !Slots.IsValidIndex(SourceIndex) || !Slots.IsValidIndex(TargetIndex) || Slots[SourceIndex].IsEmpty())
+            {
+                return false;
+            }
+
+            const FModelSlot Source = Slots[SourceIndex];
+            const FModelSlot Target = Slots[TargetIndex];
+
+            if (Target.IsEmpty())
+            {
+                Set(TargetIndex, Source.Item, Source.Quantity);
+                Set(SourceIndex, nullptr, 0);
+                return true;
+            }
+
+            if (Target.Item == Source.Item)
+            {
+                const int32 Moved = FMath::Min(FMath::Max(0, MaxStack(Target.Item) - Target.Quantity), Source.Quantity);
+                Set(TargetIndex, Target.Item, Target.Quantity + Moved);
+                Set(SourceIndex, Source.Item, Source.Quantity - Moved);
+                return Moved > 0;
+            }
+
+            Set(TargetIndex, Source.Item, Source.Quantity);
+            Set(SourceIndex, Target.Item, Target.Quantity);
+            return true;
+        }
+
+        /** TransferItemToInventory between two different inventories. */
+        static bool Transfer(FInventoryModel& Source, int32 SourceIndex, FInventoryModel& Target, int32 TargetIndex)
+        {
+            if (!Source.Slots.IsValidIndex(SourceIndex) || !Target.Slots.IsValidIndex(TargetIndex) || Source.Slots[SourceIndex].IsEmpty())
+            {
+                return false;
+            }
+
+            const FModelSlot From = Source.Slots[SourceIndex];
+            const FModelSlot To = Target.Slots[TargetIndex];
+
+            if (To.IsEmpty())
+            {
+                const int32 Moved = FMath::Clamp(From.Quantity, 0, MaxStack(From.Item));
+                Target.Set(TargetIndex, From.Item, Moved);
+                Source.Set(SourceIndex, From.Item, From.Quantity - Moved);
+                return Moved > 0;
+            }
+
+            if (To.Item == From.Item)
+            {
+                const int32 Space = FMath::Max(0, MaxStack(To.Item) - To.Quantity);
+                const int32 Moved = FMath::Min(Space, From.Quantity);
+                if (Moved <= 0)
+                {
+                    return false;
+                }
+
+                Target.Set(TargetIndex, To.Item, To.Quantity + Moved);
+                Source.Set(SourceIndex, From.Item, From.Quantity - Moved);
+                return true;
+            }
+
+            Target.Set(TargetIndex, From.Item, From.Quantity);
+            Source.Set(SourceIndex, To.Item, To.Quantity);
+            return true;
+        }
+
+        /** TakeAllFromInventory: each source slot, in slot order, is added to the target as far as it fits. */
+        static int32 TakeAll(FInventoryModel& Source, FInventoryModel& Target)
+        {
+            int32 Moved = 0;
+            for (int32 Index = 0; Index < Source.Slots.Num(); ++Index)
+            {
+                const FModelSlot From = Source.Slots[Index];
+                if (From.IsEmpty())
+                {
+                    continue;
+                }
+
+                const int32 Added = Target.AddItem(From.Item, From.Quantity);
+                Source.Set(Index, From.Item, From.Quantity - Added);
+                Moved += Added;
+            }
+            return Moved;
+        }
+
+        /** Stacked drop mode: the whole stack leaves the inventory. Returns the units dropped. */
+        int32 Drop(int32 Index)
+        {
+            if (!Slots.IsValidIndex(Index) || Slots[Index].IsEmpty())
+            {
+                return 0;
+            }
+
+            const int32 Dropped = Slots[Index].Quantity;
+            Set(Index, nullptr, 0);
+            return Dropped;
+        }
+
+        /**
+         * Resizes to the saved slot count, empties every slot, then applies the saved entries in order: each
+         * lands in its SlotIndex (or its position when INDEX_NONE), later entries win, and quantities are
+         * clamped to the stack cap.
+         */
+        void ReadFromSaveData(const FInventorySaveData& Data, const TMap<FSoftObjectPath, UItemData*>& ItemsByPath)
+        {
+            if (Data.MaxSlots > 0)
+            {
+                Slots.SetNum(Data.MaxSlots);
+            }
+
+            for (int32 Index = 0; Index < Slots.Num(); ++Index)
+            {
+                Set(Index, nullptr, 0);
+            }
+
+            for (int32 EntryIndex = 0; EntryIndex < Data.Slots.Num(); ++EntryIndex)
+            {
+                const FInventorySlotSaveData& Saved = Data.Slots[EntryIndex];
+                const int32 Index = Saved.SlotIndex != INDEX_NONE ? Saved.SlotIndex : EntryIndex;
+                if (!Slots.IsValidIndex(Index))
+                {
+                    continue;
+                }
+
+                UItemData* const* Item = ItemsByPath.Find(Saved.ItemPath);
+                if (Saved.ItemPath.IsNull() || !Item || Saved.Quantity <= 0)
+                {
+                    Set(Index, nullptr, 0);
+                    continue;
+                }
+
+                Set(Index, *Item, FMath::Clamp(Saved.Quantity, 0, MaxStack(*Item)));
+            }
+        }
+    };
+
+    /**
+     * Compares every slot plus the cached aggregates against the model. Only the first difference is
+     * reported so a broken step does not bury the log; returns false when anything differs.
+     */
+    inline bool VerifyInventory(FAutomationTestBase& Test, const UInventoryComponent& Inventory, const FInventoryModel& Model, TArrayView<UItemData* const> Items, const FString& Context)
+    {
+        const TArray<FItemStack>& Slots = Inventory.GetSlots();
+        if (Slots.Num() != Model.Slots.Num())
+        {
+            Test.AddError(FString::Printf(TEXT("%s: slot count %d, expected %d"), *Context, Slots.Num(), Model.Slots.Num()));
+            return false;
+        }
+
+        double ExpectedWeight = 0.0;
+        double ExpectedVolume = 0.0;
+
+        for (int32 Index = 0; Index < Slots.Num(); ++Index)
+        {
+            const FItemStack& Slot = Slots[Index];
+            const FModelSlot& Expected = Model.Slots[Index];
+
+            if (Slot.Item != Expected.Item || Slot.Quantity != Expected.Quantity)
+            {
+                Test.AddError(FString::Printf(TEXT("%s: slot %d holds %s x%d, expected %s x%d"), *Context, Index,
+                    *GetNameSafe(Slot.Item), Slot.Quantity, *GetNameSafe(Expected.Item), Expected.Quantity));
+                return false;
+            }
+
+            if (Slot.Quantity < 0 || (Slot.Item && Slot.Quantity > FInventoryModel::MaxStack(Slot.Item)) || (!Slot.Item && Slot.Quantity != 0))
+            {
+                Test.AddError(FString::Printf(TEXT("%s: slot %d breaks the stack cap (%s x%d)"), *Context, Index, *GetNameSafe(Slot.Item), Slot.Quantity));
+                return false;
+            }
+
+            if (Expected.Item)
+            {
+                const FItemPhysicalProperties Properties = Expected.Item->GetPhysicalProperties();
+                ExpectedWeight += static_cast<double>(Properties.WeightKg) * Expected.Quantity;
+                ExpectedVolume += static_cast<double>(Properties.VolumeM3) * Expected.Quantity;
+            }
+        }
+
+        for (UItemData* Item : Items)
+        {
+            if (Inventory.CountItem(Item) != Model.Count(Item))
+            {
+                Test.AddError(FString::Printf(TEXT("%s: CountItem(%s) = %d, expected %d"), *Context, *GetNameSafe(Item), Inventory.CountItem(Item), Model.Count(Item)));
+                return false;
+            }
+        }
+
+        if (!FMath::IsNearlyEqual(static_cast<double>(Inventory.GetTotalWeight()), ExpectedWeight, FMath::Max(1e-3, ExpectedWeight * 1e-5))
+            || !FMath::IsNearlyEqual(static_cast<double>(Inventory.GetTotalVolume()), ExpectedVolume, FMath::Max(1e-5, ExpectedVolume * 1e-5)))
+        {
+            Test.AddError(FString::Printf(TEXT("%s: totals %.4f kg / %.6f m3, expected %.4f kg / %.6f m3"), *Context,
+                Inventory.GetTotalWeight(), Inventory.GetTotalVolume(), ExpectedWeight, ExpectedVolume));
+            return false;
+        }
+
+        if (Inventory.IsEmpty() != (Model.TotalUnits() == 0))
+        {
+            Test.AddError(FString::Printf(TEXT("%s: IsEmpty() disagrees with the model"), *Context));
+            return false;
+        }
+
+        return true;
+    }
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
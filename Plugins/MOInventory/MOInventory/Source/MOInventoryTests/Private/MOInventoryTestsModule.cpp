@@ -0,0 +1,5 @@
+// Implementation: Developer-only module hosting the inventory automation specs. Run headless with
+// UnrealEditor-Cmd <Project>.uproject -nullrhi -unattended -ExecCmds="Automation RunTests MO56.Inventory;Quit".
+#include "Modules/ModuleManager.h"
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, MOInventoryTests);
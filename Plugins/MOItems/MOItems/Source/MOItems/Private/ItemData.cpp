@@ -5,26 +5,47 @@
 #include "PhysicsEngine/BodySetup.h"
 #include "PhysicsEngine/PhysicsAsset.h"
 #include "PhysicsEngine/SkeletalBodySetup.h"
+#include "UObject/ObjectKey.h"
+
+#if WITH_EDITOR
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/UnrealType.h"
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogItemData, Log, All);
 
 namespace
 {
         constexpr float KgToLbs = 2.20462262f;
         constexpr float Cm3ToM3 = 1.0e-6f;
-}
 
-float UItemData::GetWeightKg() const
-{
-        if (WeightKgOverride > 0.f)
-        {
-                return WeightKgOverride;
-        }
+        /** Fallback for assets saved before physical properties were baked; filled once per item, cleared only by a bake. */
+        TMap<TObjectKey<UItemData>, FItemPhysicalProperties> RuntimePhysicalPropertiesCache;
 
-        if (WeightLbsOverride > 0.f)
+        /** Un-baked items already reported, so each one warns once per session. */
+        TSet<TObjectKey<UItemData>> WarnedUnbakedItems;
+
+        /** Loads the mesh only when allowed; otherwise returns it if resident and flags a set-but-unloaded reference. */
+        template <typename MeshType>
+        MeshType* ResolveWorldMesh(const TSoftObjectPtr<MeshType>& Mesh, bool bLoadMeshes, bool* bOutMissingMesh)
         {
-                return WeightLbsOverride / KgToLbs;
+                if (bLoadMeshes)
+                {
+                        return Mesh.LoadSynchronous();
+                }
+
+                MeshType* Resident = Mesh.Get();
+                if (!Resident && !Mesh.IsNull() && bOutMissingMesh)
+                {
+                        *bOutMissingMesh = true;
+                }
+                return Resident;
         }
+}
 
-        return CalculateDefaultWeightKg();
+float UItemData::GetWeightKg() const
+{
+        return GetPhysicalProperties().WeightKg;
 }
 
 float UItemData::GetWeightLbs() const
@@ -39,33 +60,143 @@ float UItemData::GetWeightLbs() const
 
 float UItemData::GetVolumeCubicMeters() const
 {
-        if (VolumeOverride > 0.f)
+        return GetPhysicalProperties().VolumeM3;
+}
+
+float UItemData::GetDensity() const
+{
+        return GetPhysicalProperties().Density;
+}
+
+FItemPhysicalProperties UItemData::GetPhysicalProperties() const
+{
+        if (bHasBakedPhysicalProperties)
         {
-                return VolumeOverride;
+                return BakedPhysicalProperties;
         }
 
-        return CalculateDefaultVolumeCubicMeters();
+        check(IsInGameThread());
+
+        const TObjectKey<UItemData> Key(this);
+        if (const FItemPhysicalProperties* Cached = RuntimePhysicalPropertiesCache.Find(Key))
+        {
+                return *Cached;
+        }
+
+        // Never load world meshes here: un-baked assets use whatever is already resident until they are resaved.
+        bool bMissingMesh = false;
+        const FItemPhysicalProperties Result = CalculatePhysicalProperties(false, &bMissingMesh);
+
+        bool bAlreadyWarned = false;
+        WarnedUnbakedItems.Add(Key, &bAlreadyWarned);
+        if (!bAlreadyWarned)
+        {
+                UE_LOG(LogItemData, Warning, TEXT("%s has no baked physical properties; resave the asset.%s"),
+                        *GetPathName(),
+                        bMissingMesh ? TEXT(" Its world mesh is not loaded, so weight/volume may read as zero until it is.") : TEXT(""));
+        }
+
+        // Cached even when a mesh was missing: inventories add and subtract these values, so they must not change
+        // when the mesh streams in later.
+        return RuntimePhysicalPropertiesCache.Add(Key, Result);
 }
 
-float UItemData::GetDensity() const
+#if WITH_EDITOR
+FOnItemPhysicalPropertiesChanged UItemData::OnPhysicalPropertiesChanged;
+
+void UItemData::PreSave(FObjectPreSaveContext SaveContext)
 {
-        if (DensityOverride > 0.f)
+        Super::PreSave(SaveContext);
+
+        BakePhysicalProperties();
+}
+
+void UItemData::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+        Super::PostEditChangeProperty(PropertyChangedEvent);
+
+        static const TSet<FName> BakeInputs =
+        {
+                GET_MEMBER_NAME_CHECKED(UItemData, WorldStaticMesh),
+                GET_MEMBER_NAME_CHECKED(UItemData, WorldSkeletalMesh),
+                GET_MEMBER_NAME_CHECKED(UItemData, WorldScale3D),
+                GET_MEMBER_NAME_CHECKED(UItemData, WeightKgOverride),
+                GET_MEMBER_NAME_CHECKED(UItemData, WeightLbsOverride),
+                GET_MEMBER_NAME_CHECKED(UItemData, VolumeOverride),
+                GET_MEMBER_NAME_CHECKED(UItemData, DensityOverride),
+        };
+
+        // Unknown (NAME_None) changes such as undo may touch anything, so they re-bake too.
+        const FName PropertyName = PropertyChangedEvent.GetMemberPropertyName();
+        if (PropertyName.IsNone() || BakeInputs.Contains(PropertyName))
+        {
+                BakePhysicalProperties();
+        }
+}
+
+void UItemData::BakePhysicalProperties()
+{
+        // Values handed out before this bake, if any; only a change to those needs holders to rebuild.
+        TOptional<FItemPhysicalProperties> Previous;
+        FItemPhysicalProperties Cached;
+        if (bHasBakedPhysicalProperties)
         {
-                return DensityOverride;
+                Previous = BakedPhysicalProperties;
         }
+        else if (RuntimePhysicalPropertiesCache.RemoveAndCopyValue(TObjectKey<UItemData>(this), Cached))
+        {
+                Previous = Cached;
+        }
+
+        WarnedUnbakedItems.Remove(TObjectKey<UItemData>(this));
 
-        const float Volume = GetVolumeCubicMeters();
-        if (Volume <= KINDA_SMALL_NUMBER)
+        BakedPhysicalProperties = CalculatePhysicalProperties(true, nullptr);
+        bHasBakedPhysicalProperties = true;
+
+        if (Previous.IsSet()
+                && (Previous->WeightKg != BakedPhysicalProperties.WeightKg
+                        || Previous->VolumeM3 != BakedPhysicalProperties.VolumeM3
+                        || Previous->Density != BakedPhysicalProperties.Density))
+        {
+                OnPhysicalPropertiesChanged.Broadcast(this);
+        }
+}
+#endif
+
+FItemPhysicalProperties UItemData::CalculatePhysicalProperties(bool bLoadMeshes, bool* bOutMissingMesh) const
+{
+        FItemPhysicalProperties Result;
+
+        if (WeightKgOverride > 0.f)
+        {
+                Result.WeightKg = WeightKgOverride;
+        }
+        else if (WeightLbsOverride > 0.f)
+        {
+                Result.WeightKg = WeightLbsOverride / KgToLbs;
+        }
+        else
+        {
+                Result.WeightKg = CalculateDefaultWeightKg(bLoadMeshes, bOutMissingMesh);
+        }
+
+        Result.VolumeM3 = VolumeOverride > 0.f ? VolumeOverride : CalculateDefaultVolumeCubicMeters(bLoadMeshes, bOutMissingMesh);
+
+        if (DensityOverride > 0.f)
+        {
+                Result.Density = DensityOverride;
+        }
+        else if (Result.VolumeM3 > KINDA_SMALL_NUMBER)
         {
-                return 0.f;
+                Result.Density = Result.WeightKg / Result.VolumeM3;
         }
 
-        return GetWeightKg() / Volume;
+        return Result;
 }
 
-float UItemData::CalculateDefaultWeightKg() const
+float UItemData::CalculateDefaultWeightKg(bool bLoadMeshes, bool* bOutMissingMesh) const
 {
-        if (UStaticMesh* StaticMesh = WorldStaticMesh.LoadSynchronous())
+        if (UStaticMesh* StaticMesh = ResolveWorldMesh(WorldStaticMesh, bLoadMeshes, bOutMissingMesh))
         {
                 if (UBodySetup* BodySetup = StaticMesh->GetBodySetup())
                 {
@@ -83,7 +214,7 @@ float UItemData::CalculateDefaultWeightKg() const
                 }
         }
 
-        if (USkeletalMesh* SkeletalMesh = WorldSkeletalMesh.LoadSynchronous())
+        if (USkeletalMesh* SkeletalMesh = ResolveWorldMesh(WorldSkeletalMesh, bLoadMeshes, bOutMissingMesh))
         {
                 if (UPhysicsAsset* PhysicsAsset = SkeletalMesh->GetPhysicsAsset())
                 {
@@ -106,11 +237,11 @@ float UItemData::CalculateDefaultWeightKg() const
         return 0.f;
 }
 
-float UItemData::CalculateDefaultVolumeCubicMeters() const
+float UItemData::CalculateDefaultVolumeCubicMeters(bool bLoadMeshes, bool* bOutMissingMesh) const
 {
         float VolumeCm3 = 0.f;
 
-        if (UStaticMesh* StaticMesh = WorldStaticMesh.LoadSynchronous())
+        if (UStaticMesh* StaticMesh = ResolveWorldMesh(WorldStaticMesh, bLoadMeshes, bOutMissingMesh))
         {
                 if (UBodySetup* BodySetup = StaticMesh->GetBodySetup())
                 {
@@ -127,7 +258,7 @@ float UItemData::CalculateDefaultVolumeCubicMeters() const
 
         if (VolumeCm3 <= 0.f)
         {
-                if (USkeletalMesh* SkeletalMesh = WorldSkeletalMesh.LoadSynchronous())
+                if (USkeletalMesh* SkeletalMesh = ResolveWorldMesh(WorldSkeletalMesh, bLoadMeshes, bOutMissingMesh))
                 {
                         const FBoxSphereBounds Bounds = SkeletalMesh->GetBounds();
                         const FVector Extents = Bounds.BoxExtent * WorldScale3D * 2.f;
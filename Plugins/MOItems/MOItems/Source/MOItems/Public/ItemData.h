@@ -8,6 +8,31 @@ class UTexture2D;
 class UStaticMesh;
 class USkeletalMesh;
 class AActor;
+class UItemData;
+
+#if WITH_EDITOR
+/** Broadcast when a bake changes an item's per-unit values, so holders of cached totals can rebuild them. */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnItemPhysicalPropertiesChanged, const UItemData*);
+#endif
+
+/** Weight/volume/density resolved for a single unit of an item. */
+USTRUCT(BlueprintType)
+struct MOITEMS_API FItemPhysicalProperties
+{
+        GENERATED_BODY()
+
+        /** Weight of one unit in kilograms. */
+        UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Item|Physics", meta=(ForceUnits="kg"))
+        float WeightKg = 0.f;
+
+        /** Volume of one unit in cubic meters. */
+        UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Item|Physics", meta=(ForceUnits="m^3"))
+        float VolumeM3 = 0.f;
+
+        /** Density in kg / m^3. */
+        UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Item|Physics", meta=(ForceUnits="kg/m^3"))
+        float Density = 0.f;
+};
 
 UCLASS(BlueprintType)
 class MOITEMS_API UItemData : public UDataAsset
@@ -58,6 +83,14 @@ public:
         UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Item|Physics", meta=(ClampMin="0", ForceUnits="kg/m^3"))
         float DensityOverride = 0.f;
 
+        /** Physical properties baked from the overrides and world meshes when the asset is saved or cooked. */
+        UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Item|Physics")
+        FItemPhysicalProperties BakedPhysicalProperties;
+
+        /** True once BakedPhysicalProperties has been populated by the editor. */
+        UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Item|Physics")
+        bool bHasBakedPhysicalProperties = false;
+
         /** When true the item will be dropped as a container when spawned into the world. */
         UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Item|Behavior")
         bool bDropAsContainer = false;
@@ -104,7 +137,30 @@ public:
         UFUNCTION(BlueprintCallable, Category="Item|Physics")
         float GetDensity() const;
 
+        /**
+         * Returns weight, volume and density for one unit. Uses the baked values when present; un-baked
+         * items are computed once from their overrides and already-loaded meshes (never loading them), warn,
+         * and keep that first result for the session so the values never change under a running total.
+         */
+        FItemPhysicalProperties GetPhysicalProperties() const;
+
+#if WITH_EDITOR
+        virtual void PreSave(FObjectPreSaveContext SaveContext) override;
+        virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+
+        /** Recomputes BakedPhysicalProperties from the overrides and world meshes. */
+        void BakePhysicalProperties();
+
+        /** Fired by BakePhysicalProperties when the per-unit values it produces differ from those in use before. */
+        static FOnItemPhysicalPropertiesChanged OnPhysicalPropertiesChanged;
+#endif
+
 private:
-        float CalculateDefaultWeightKg() const;
-        float CalculateDefaultVolumeCubicMeters() const;
+        /**
+         * Resolves the properties from the overrides and world meshes. With bLoadMeshes false only resident
+         * meshes are used, and bOutMissingMesh (if given) is set when a referenced mesh was not loaded.
+         */
+        FItemPhysicalProperties CalculatePhysicalProperties(bool bLoadMeshes, bool* bOutMissingMesh) const;
+        float CalculateDefaultWeightKg(bool bLoadMeshes, bool* bOutMissingMesh) const;
+        float CalculateDefaultVolumeCubicMeters(bool bLoadMeshes, bool* bOutMissingMesh) const;
 };
@@ -1,6 +1,7 @@
 #include "Crafting/CraftingSystemComponent.h"
 
 #include "Engine/AssetManager.h"
+#include "Engine/GameInstance.h"
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
 #include "InventoryComponent.h"
@@ -8,6 +9,7 @@
 #include "TimerManager.h"
 
 #include "Crafting/CraftingRecipe.h"
+#include "Save/MO56SaveSubsystem.h"
 #include "Skills/SkillSystemComponent.h"
 #include "Skills/SkillTypes.h"
 
@@ -217,6 +219,18 @@ void UCraftingSystemComponent::FinishCraftInternal(bool bWasSuccessful)
         BroadcastCraftFinished(ActiveCraft.Recipe, bWasSuccessful);
         ClientCraftFinished(ActiveCraft.Recipe, bWasSuccessful);
         ActiveCraft.Reset();
+
+        // Crafted outputs cost the player time and materials; get them to disk ahead of routine autosaves.
+        if (bWasSuccessful)
+        {
+                if (UGameInstance* GameInstance = GetWorld() ? GetWorld()->GetGameInstance() : nullptr)
+                {
+                        if (UMO56SaveSubsystem* SaveSubsystem = GameInstance->GetSubsystem<UMO56SaveSubsystem>())
+                        {
+                                SaveSubsystem->RequestAutosave(EMO56AutosavePriority::High);
+                        }
+                }
+        }
 }
 
 bool UCraftingSystemComponent::CanCraftRecipe(const UCraftingRecipe& Recipe) const
@@ -278,6 +292,7 @@ void UCraftingSystemComponent::ConsumeReservations(const TArray<FCraftingReserva
 {
         if (UInventoryComponent* Inventory = ResolveInventoryComponent())
         {
+                FInventoryTransaction Transaction(Inventory);
                 for (const FCraftingReservation& Reservation : Reservations)
                 {
                         if (Reservation.Quantity <= 0 || Reservation.ItemId.IsNone())
@@ -308,6 +323,7 @@ void UCraftingSystemComponent::GrantOutputs(const UCraftingRecipe& Recipe, bool
                 return;
         }
 
+        FInventoryTransaction Transaction(Inventory);
         const TMap<FName, int32>& Results = bWasSuccessful ? Recipe.Outputs : Recipe.FailByproducts;
         for (const TPair<FName, int32>& Entry : Results)
         {
@@ -452,9 +468,18 @@ int32 UCraftingSystemComponent::CountItemInInventory(const FName& ItemId) const
                 return 0;
         }
 
+        if (UAssetManager* AssetManager = UAssetManager::GetIfInitialized())
+        {
+                // An item that is not loaded cannot be held by the inventory, so resolve without loading.
+                const FSoftObjectPath AssetPath = AssetManager->GetPrimaryAssetPath(FPrimaryAssetId(TEXT("Item"), ItemId));
+                if (!AssetPath.IsNull())
+                {
+                        return Inventory->CountItem(Cast<UItemData>(AssetPath.ResolveObject()));
+                }
+        }
+
         int32 TotalCount = 0;
-        const TArray<FItemStack>& Slots = Inventory->GetSlots();
-        for (const FItemStack& Slot : Slots)
+        for (const FItemStack& Slot : Inventory->GetStoredSlots())
         {
                 if (!Slot.Item)
                 {
@@ -7,10 +7,21 @@
 #include "MO56Character.h"
 #include "MO56PlayerController.h"
 #include "Components/SceneComponent.h"
-#include "Algo/AllOf.h"
 #include "Internationalization/Text.h"
 #include "Save/MO56SaveSubsystem.h"
 #include "Engine/GameInstance.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "Net/Core/Misc/NetConditionGroupManager.h"
+
+namespace
+{
+        static TAutoConsoleVariable<int32> CVarContainerViewerReplication(
+                TEXT("MO56.Net.ContainerViewerReplication"),
+                1,
+                TEXT("Replicate container inventories only to connections whose character has the container open. Read when a container begins play."),
+                ECVF_Default);
+}
 
 AInventoryContainer::AInventoryContainer()
 {
@@ -22,6 +33,9 @@ AInventoryContainer::AInventoryContainer()
 
         bReplicates = true;
         SetReplicateMovement(true);
+
+        // Needed for the per-connection net condition on InventoryComponent.
+        bReplicateUsingRegisteredSubObjectList = true;
 }
 
 void AInventoryContainer::BeginPlay()
@@ -30,6 +44,16 @@ void AInventoryContainer::BeginPlay()
 
         if (InventoryComponent)
         {
+                if (HasAuthority() && CVarContainerViewerReplication.GetValueOnGameThread() != 0)
+                {
+                        // Only connections that join this group (by opening the container) receive the slots; everyone
+                        // else keeps the actor but never pays for its contents.
+                        ViewerNetGroup = FName(TEXT("ContainerViewers"), GetUniqueID());
+                        UE::Net::FNetConditionGroupManager::RegisterSubObjectInGroup(InventoryComponent, ViewerNetGroup);
+                        SetReplicatedComponentNetCondition(InventoryComponent, COND_NetGroup);
+                }
+
+                InventoryComponent->AccessCheck.BindUObject(this, &AInventoryContainer::CanControllerAccessInventory);
                 InventoryComponent->OnInventoryUpdated.AddDynamic(this, &AInventoryContainer::HandleInventoryUpdated);
                 HandleInventoryUpdated();
 
@@ -69,6 +93,13 @@ void AInventoryContainer::EndPlay(const EEndPlayReason::Type EndPlayReason)
                 }
         }
         ActiveCharacters.Empty();
+        RemoveAllInventoryViewers();
+
+        if (InventoryComponent && !ViewerNetGroup.IsNone())
+        {
+                UE::Net::FNetConditionGroupManager::UnregisterSubObjectFromGroup(InventoryComponent, ViewerNetGroup);
+                ViewerNetGroup = NAME_None;
+        }
 
         Super::EndPlay(EndPlayReason);
 }
@@ -80,18 +111,9 @@ void AInventoryContainer::HandleInventoryUpdated()
                 return;
         }
 
-        if (bDestroyWhenEmpty)
+        if (bDestroyWhenEmpty && InventoryComponent->IsEmpty())
         {
-                const TArray<FItemStack>& Slots = InventoryComponent->GetSlots();
-                const bool bIsEmpty = Algo::AllOf(Slots, [](const FItemStack& Stack)
-                {
-                        return Stack.IsEmpty();
-                });
-
-                if (bIsEmpty)
-                {
-                        HandleContainerEmptied();
-                }
+                HandleContainerEmptied();
         }
 
         if (HasAuthority())
@@ -110,10 +132,74 @@ void AInventoryContainer::HandleContainerEmptied()
                 }
         }
         ActiveCharacters.Empty();
+        RemoveAllInventoryViewers();
 
         Destroy();
 }
 
+void AInventoryContainer::AddInventoryViewer(AMO56Character* Character)
+{
+        if (!HasAuthority() || ViewerNetGroup.IsNone() || !Character)
+        {
+                return;
+        }
+
+        APlayerController* Controller = Cast<APlayerController>(Character->GetController());
+        if (!Controller || Controller->IsLocalController())
+        {
+                // The listen server's own view reads the authoritative component directly.
+                return;
+        }
+
+        ViewerControllers.Add(Character, Controller);
+        if (!Controller->IsMemberOfNetConditionGroup(ViewerNetGroup))
+        {
+                Controller->IncludeInNetConditionGroup(ViewerNetGroup);
+
+                // The first update after joining carries every slot the client has not acknowledged yet.
+                ForceNetUpdate();
+        }
+}
+
+void AInventoryContainer::RemoveInventoryViewer(AMO56Character* Character)
+{
+        TWeakObjectPtr<APlayerController> ControllerPtr;
+        if (!ViewerControllers.RemoveAndCopyValue(Character, ControllerPtr))
+        {
+                return;
+        }
+
+        APlayerController* Controller = ControllerPtr.Get();
+        if (!Controller)
+        {
+                return;
+        }
+
+        // Another pawn of the same connection may still have the container open.
+        for (const TPair<TWeakObjectPtr<AMO56Character>, TWeakObjectPtr<APlayerController>>& Pair : ViewerControllers)
+        {
+                if (Pair.Value.Get() == Controller)
+                {
+                        return;
+                }
+        }
+
+        Controller->RemoveFromNetConditionGroup(ViewerNetGroup);
+}
+
+void AInventoryContainer::RemoveAllInventoryViewers()
+{
+        for (const TPair<TWeakObjectPtr<AMO56Character>, TWeakObjectPtr<APlayerController>>& Pair : ViewerControllers)
+        {
+                if (APlayerController* Controller = Pair.Value.Get())
+                {
+                        Controller->RemoveFromNetConditionGroup(ViewerNetGroup);
+                }
+        }
+
+        ViewerControllers.Reset();
+}
+
 void AInventoryContainer::Interact_Implementation(AActor* Interactor)
 {
         if (!Interactor)
@@ -136,6 +222,7 @@ void AInventoryContainer::Interact_Implementation(AActor* Interactor)
                 {
                         if (HasAuthority())
                         {
+                                NotifyInventoryClosed(Character);
                                 Character->CloseContainerInventoryForActor(this);
 
                                 if (AMO56PlayerController* MOController = Cast<AMO56PlayerController>(Character->GetController()))
@@ -158,6 +245,8 @@ void AInventoryContainer::Interact_Implementation(AActor* Interactor)
 
                 if (HasAuthority())
                 {
+                        AddInventoryViewer(Character);
+
                         Character->OpenContainerInventory(InventoryComponent, this);
 
                         if (AMO56PlayerController* MOController = Cast<AMO56PlayerController>(Character->GetController()))
@@ -185,7 +274,14 @@ FText AInventoryContainer::GetInteractText_Implementation() const
         return NSLOCTEXT("InventoryContainer", "InteractPrompt", "Open Container");
 }
 
+bool AInventoryContainer::CanControllerAccessInventory(const AController* Requester) const
+{
+        AMO56Character* Character = Requester ? Cast<AMO56Character>(Requester->GetPawn()) : nullptr;
+        return Character && ActiveCharacters.Contains(Character);
+}
+
 void AInventoryContainer::NotifyInventoryClosed(AMO56Character* Character)
 {
         ActiveCharacters.Remove(Character);
+        RemoveInventoryViewer(Character);
 }
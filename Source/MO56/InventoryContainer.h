@@ -11,6 +11,8 @@
 class UInventoryComponent;
 class USceneComponent;
 class AMO56Character;
+class AController;
+class APlayerController;
 
 /**
  * Actor that exposes an inventory component and opens it when interacted with.
@@ -21,6 +23,8 @@ class AMO56Character;
  * 3. Customize InteractPrompt and bDestroyWhenEmpty in the Details panel to match the gameplay loop.
  * 4. Hook the NotifyInventoryClosed event to close lid animations or re-enable physics when players leave.
  * 5. Place the Blueprint in levels and ensure Interact_Implementation is reachable via your interact trace channel.
+ * 6. The inventory only replicates to connections whose character has the container open (MO56.Net.ContainerViewerReplication);
+ *    anything that must be visible to every client belongs on the actor, not in the inventory.
  */
 UCLASS()
 class MO56_API AInventoryContainer : public AActor, public IInteractable
@@ -49,6 +53,14 @@ protected:
 
         void HandleContainerEmptied();
 
+        /** Access rule bound to InventoryComponent: only controllers whose character has the container open. */
+        bool CanControllerAccessInventory(const AController* Requester) const;
+
+        /** Adds or removes the character's connection from the group that receives InventoryComponent. Authority only. */
+        void AddInventoryViewer(AMO56Character* Character);
+        void RemoveInventoryViewer(AMO56Character* Character);
+        void RemoveAllInventoryViewers();
+
 protected:
         UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components", meta = (AllowPrivateAccess = "true"))
         TObjectPtr<USceneComponent> Root;
@@ -66,4 +78,11 @@ protected:
 
         /** Characters currently viewing the container inventory. */
         TSet<TWeakObjectPtr<AMO56Character>> ActiveCharacters;
+
+private:
+        /** Net condition group InventoryComponent is registered in; NAME_None when it replicates to everyone. */
+        FName ViewerNetGroup;
+
+        /** Controller each viewing character joined the group through, so it can leave after unpossessing. */
+        TMap<TWeakObjectPtr<AMO56Character>, TWeakObjectPtr<APlayerController>> ViewerControllers;
 };
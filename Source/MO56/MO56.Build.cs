@@ -28,7 +28,7 @@ public class MO56 : ModuleRules
 			"PhysicsCore"
 		});
 
-		PrivateDependencyModuleNames.AddRange(new string[] { });
+		PrivateDependencyModuleNames.AddRange(new string[] { "NetCore" });
 
 		PublicIncludePaths.AddRange(new string[]
 		{
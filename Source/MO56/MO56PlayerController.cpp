@@ -702,6 +702,13 @@ void AMO56PlayerController::ServerRequestContainerInventoryOwnership_Implementat
 
         LogDebugEvent(TEXT("ServerRequestContainerOwnership"), FString::Printf(TEXT("Container=%s"), *GetNameSafe(ContainerActor)));
 
+        // Only a player with the container open may route inventory RPCs through it.
+        UInventoryComponent* ContainerInventory = ContainerActor->GetInventoryComponent();
+        if (!ContainerInventory || !ContainerInventory->CanBeAccessedBy(this))
+        {
+                return;
+        }
+
         ContainerActor->SetOwner(this);
 }
 
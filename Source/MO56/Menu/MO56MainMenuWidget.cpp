@@ -55,10 +55,22 @@ void UMO56MainMenuWidget::NativeConstruct()
                 UE_LOG(LogTemp, Warning, TEXT("%s missing SaveList binding"), *GetName());
         }
 
+        // The list shows the cached index straight away and is filled again once the folder rescan lands.
+        if (UMO56SaveSubsystem* SaveSubsystem = ResolveSubsystem())
+        {
+                SaveSubsystem->OnSaveIndexUpdated.RemoveDynamic(this, &ThisClass::HandleSaveIndexUpdated);
+                SaveSubsystem->OnSaveIndexUpdated.AddDynamic(this, &ThisClass::HandleSaveIndexUpdated);
+        }
+
         RefreshSaveEntries();
 }
 
 void UMO56MainMenuWidget::RefreshSaveEntries()
+{
+        PopulateSaveEntries(true);
+}
+
+void UMO56MainMenuWidget::PopulateSaveEntries(bool bRebuildIndex)
 {
         if (!SaveList)
         {
@@ -76,7 +88,7 @@ void UMO56MainMenuWidget::RefreshSaveEntries()
 
         if (UMO56SaveSubsystem* SaveSubsystem = ResolveSubsystem())
         {
-                const TArray<FSaveIndexEntry> Entries = SaveSubsystem->ListSaves(true);
+                const TArray<FSaveIndexEntry> Entries = SaveSubsystem->ListSaves(bRebuildIndex);
 
                 for (const FSaveIndexEntry& Entry : Entries)
                 {
@@ -212,7 +224,9 @@ void UMO56MainMenuWidget::HandleClearAllSavesClicked()
         {
                 const bool bOK = SS->DeleteAllSaves(true, false);
                 UE_LOG(LogTemp, Log, TEXT("ClearAllSaves clicked. Result: %s"), bOK ? TEXT("OK") : TEXT("Fail"));
-                RefreshSaveEntries();
+
+                // DeleteAllSaves already emptied the index and started a rescan.
+                PopulateSaveEntries(false);
         }
 }
 
@@ -221,6 +235,11 @@ void UMO56MainMenuWidget::HandleSaveChosen(FGuid SaveId)
         HandleSaveEntryClicked(SaveId);
 }
 
+void UMO56MainMenuWidget::HandleSaveIndexUpdated()
+{
+        PopulateSaveEntries(false);
+}
+
 void UMO56MainMenuWidget::NativeDestruct()
 {
         if (NewGameButton)
@@ -235,6 +254,10 @@ void UMO56MainMenuWidget::NativeDestruct()
         {
                 ClearAllSavesButton->OnClicked.RemoveAll(this);
         }
+        if (UMO56SaveSubsystem* SaveSubsystem = CachedSubsystem.Get())
+        {
+                SaveSubsystem->OnSaveIndexUpdated.RemoveAll(this);
+        }
 
         Super::NativeDestruct();
 }
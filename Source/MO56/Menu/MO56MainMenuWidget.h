@@ -24,6 +24,7 @@ virtual void NativeConstruct() override;
 
 protected:
 void RefreshSaveEntries();
+void PopulateSaveEntries(bool bRebuildIndex);
 void HandleSaveEntryClicked(const FGuid& SaveId) const;
 UMO56SaveSubsystem* ResolveSubsystem() const;
 static FText FormatEntryText(const FSaveIndexEntry& Entry);
@@ -40,6 +41,9 @@ void HandleSaveChosen(FGuid SaveId);
 
 UFUNCTION()
 void HandleClearAllSavesClicked();
+
+UFUNCTION()
+void HandleSaveIndexUpdated();
 virtual void NativeDestruct() override;
 
 UPROPERTY(meta=(BindWidget)) UButton* NewGameButton = nullptr;
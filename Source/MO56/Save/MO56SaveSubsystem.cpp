@@ -3,7 +3,10 @@
 // shared state across sessions.
 #include "Save/MO56SaveSubsystem.h"
 
+#include "Algo/BinarySearch.h"
 #include "Algo/RemoveIf.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
 #include "MO56PlayerController.h"
 #include "MO56DebugLogSubsystem.h"
 #include "Util/MO56NetDebug.h"
@@ -12,6 +15,7 @@
 #include "Engine/World.h"
 #include "EngineUtils.h"
 #include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
 #include "Engine/LocalPlayer.h"
 #include "GameFramework/GameModeBase.h"
 #include "GameFramework/Actor.h"
@@ -23,8 +27,13 @@
 #include "Components/MOPersistentPawnComponent.h"
 #include "InventoryComponent.h"
 #include "ItemPickup.h"
+#include "ItemPickupPool.h"
 #include "ItemData.h"
 #include "Kismet/GameplayStatics.h"
+#include "GameFramework/SaveGame.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
 #include "Misc/ScopeExit.h"
 #include "Misc/Paths.h"
 #include "Misc/PackageName.h"
@@ -34,8 +43,12 @@
 #include "MO56Character.h"
 #include "Skills/SkillSystemComponent.h"
 #include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
 #include "TimerManager.h"
+#include "UObject/Package.h"
+#include "UObject/UnrealType.h"
 #include "Save/MO56MenuSettingsSave.h"
+#include "Save/MO56WorldItemStore.h"
 #include "MO56VersionChecks.h"
 
 
@@ -44,8 +57,243 @@ DEFINE_LOG_CATEGORY_STATIC(LogMO56SaveSubsystem, Log, All);
 namespace
 {
 static const TCHAR* const GameplayGameModeOption = TEXT("?game=/Game/MyStuff/BP_MO56GameMode.BP_MO56GameMode_C");
+
+static TAutoConsoleVariable<int32> CVarSaveAsyncWrites(
+        TEXT("MO56.Save.AsyncWrites"),
+        1,
+        TEXT("Serialize and write save snapshots on a worker thread. 0 writes them on the game thread."),
+        ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarAutosaveCoalesceSeconds(
+        TEXT("MO56.Save.Autosave.CoalesceSeconds"),
+        3.f,
+        TEXT("Quiet period after the last normal-priority change before an autosave is written; further changes restart it."),
+        ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarAutosaveMaxDataLossSeconds(
+        TEXT("MO56.Save.Autosave.MaxDataLossSeconds"),
+        60.f,
+        TEXT("Upper bound on how long a change may stay unsaved, regardless of ongoing activity or the write budget."),
+        ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarAutosaveMinIntervalSeconds(
+        TEXT("MO56.Save.Autosave.MinIntervalSeconds"),
+        10.f,
+        TEXT("Minimum time between two save writes. Clamped to MaxDataLossSeconds."),
+        ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarAutosaveMaxWritesPerMinute(
+        TEXT("MO56.Save.Autosave.MaxWritesPerMinute"),
+        4,
+        TEXT("Save writes allowed per trailing minute before normal-priority autosaves wait. 0 disables the budget."),
+        ECVF_Default);
+
+static FAutoConsoleCommandWithWorld CCmdAutosaveStatus(
+        TEXT("MO56.Save.AutosaveStatus"),
+        TEXT("Log the autosave scheduler state: pending change, priority, due time and write budget."),
+        FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+        {
+                const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+                const UMO56SaveSubsystem* SaveSubsystem = GameInstance ? GameInstance->GetSubsystem<UMO56SaveSubsystem>() : nullptr;
+                if (!SaveSubsystem)
+                {
+                        UE_LOG(LogMO56SaveSubsystem, Display, TEXT("No save subsystem for this world."));
+                        return;
+                }
+
+                UE_LOG(LogMO56SaveSubsystem, Display, TEXT("%s"), *SaveSubsystem->DescribeAutosaveState());
+        }));
+
+static const TCHAR* const SaveTempFileSuffix = TEXT(".tmp");
+
+/** Copies every reflected property into a fresh transient object; no serialization happens on the game thread. */
+USaveGame* MakeSaveSnapshot(const USaveGame& Source)
+{
+        UClass* Class = Source.GetClass();
+        USaveGame* Snapshot = NewObject<USaveGame>(GetTransientPackage(), Class);
+        for (TFieldIterator<FProperty> It(Class); It; ++It)
+        {
+                It->CopyCompleteValue_InContainer(Snapshot, &Source);
+        }
+        return Snapshot;
+}
+
+static const TCHAR* const SaveHeaderExtension = TEXT(".hdr");
+
+/** Writes Bytes to a temp file and swaps it into place, so a crash mid-write leaves the previous file intact. */
+bool WriteFileAtomically(const TArray<uint8>& Bytes, const FString& FilePath)
+{
+        IFileManager& FileManager = IFileManager::Get();
+        const FString TempPath = FilePath + SaveTempFileSuffix;
+        if (!FFileHelper::SaveArrayToFile(Bytes, *TempPath) || !FileManager.Move(*FilePath, *TempPath, true, true))
+        {
+                FileManager.Delete(*TempPath, false, true, true);
+                return false;
+        }
+
+        return true;
+}
+
+bool WriteSaveSnapshotToDisk(USaveGame* Snapshot, const FString& FilePath)
+{
+        TArray<uint8> Bytes;
+        if (!Snapshot || !UGameplayStatics::SaveGameToMemory(Snapshot, Bytes))
+        {
+                return false;
+        }
+
+        return WriteFileAtomically(Bytes, FilePath);
+}
+
+FMO56SaveHeader MakeSaveHeader(const UMO56SaveGame& SaveGame)
+{
+        FMO56SaveHeader Header;
+        Header.SaveVersion = SaveGame.SaveVersion;
+        Header.SaveId = SaveGame.SaveId;
+        Header.SlotName = SaveGame.SlotName;
+        Header.LevelName = SaveGame.LevelName;
+        Header.CreatedUtc = SaveGame.CreatedUtc;
+        Header.UpdatedUtc = SaveGame.UpdatedUtc;
+        Header.TotalPlaySeconds = SaveGame.TotalPlayTimeSeconds;
+        Header.InventoryCount = SaveGame.InventoryStates.Num();
+        Header.bIsGameplaySave = SaveGame.bIsGameplaySave;
+        return Header;
+}
+
+/** Field order is the on-disk layout; change it only together with FMO56SaveHeader::FileVersion. */
+void SerializeSaveHeaderFields(FArchive& Ar, FMO56SaveHeader& Header)
+{
+        int64 CreatedTicks = Header.CreatedUtc.GetTicks();
+        int64 UpdatedTicks = Header.UpdatedUtc.GetTicks();
+        uint8 bGameplaySave = Header.bIsGameplaySave ? 1 : 0;
+
+        Ar << Header.SaveVersion;
+        Ar << Header.SaveId;
+        Ar << Header.SlotName;
+        Ar << Header.LevelName;
+        Ar << CreatedTicks;
+        Ar << UpdatedTicks;
+        Ar << Header.TotalPlaySeconds;
+        Ar << Header.InventoryCount;
+        Ar << bGameplaySave;
+
+        if (Ar.IsLoading())
+        {
+                Header.CreatedUtc = FDateTime(CreatedTicks);
+                Header.UpdatedUtc = FDateTime(UpdatedTicks);
+                Header.bIsGameplaySave = bGameplaySave != 0;
+        }
 }
 
+bool WriteSaveHeaderFile(const FMO56SaveHeader& Header, const FString& FilePath)
+{
+        TArray<uint8> Bytes;
+        FMemoryWriter Writer(Bytes);
+
+        uint32 Magic = FMO56SaveHeader::FileMagic;
+        uint32 Version = FMO56SaveHeader::FileVersion;
+        Writer << Magic;
+        Writer << Version;
+
+        FMO56SaveHeader HeaderCopy = Header;
+        SerializeSaveHeaderFields(Writer, HeaderCopy);
+
+        return WriteFileAtomically(Bytes, FilePath);
+}
+
+/** Thread-safe; returns false for missing, truncated or other-version headers. */
+bool ReadSaveHeaderFile(const FString& FilePath, FMO56SaveHeader& OutHeader)
+{
+        TArray<uint8> Bytes;
+        if (!FFileHelper::LoadFileToArray(Bytes, *FilePath, FILEREAD_Silent))
+        {
+                return false;
+        }
+
+        FMemoryReader Reader(Bytes);
+
+        uint32 Magic = 0;
+        uint32 Version = 0;
+        Reader << Magic;
+        Reader << Version;
+        if (Reader.IsError() || Magic != FMO56SaveHeader::FileMagic || Version != FMO56SaveHeader::FileVersion)
+        {
+                return false;
+        }
+
+        FMO56SaveHeader Header;
+        SerializeSaveHeaderFields(Reader, Header);
+        if (Reader.IsError())
+        {
+                return false;
+        }
+
+        OutHeader = MoveTemp(Header);
+        return true;
+}
+
+/**
+ * Like ReadSaveHeaderFile, but also rejects a header older than its save (the body was rewritten without it).
+ * SaveModifiedUtc is the save's timestamp, which directory scans already have from their stat pass.
+ */
+bool ReadCurrentSaveHeaderFile(const FString& HeaderPath, const FDateTime& SaveModifiedUtc, FMO56SaveHeader& OutHeader)
+{
+        const FDateTime HeaderTime = IFileManager::Get().GetTimeStamp(*HeaderPath);
+        if (HeaderTime == FDateTime::MinValue() || HeaderTime < SaveModifiedUtc)
+        {
+                return false;
+        }
+
+        return ReadSaveHeaderFile(HeaderPath, OutHeader);
+}
+}
+
+struct UMO56SaveSubsystem::FSaveWriteBatch
+{
+        struct FItem
+        {
+                FString SlotName;
+                FString FilePath;
+                USaveGame* Snapshot = nullptr;
+                bool bSucceeded = false;
+
+                /** Set for gameplay saves; written to HeaderPath once the body has been committed. */
+                TOptional<FMO56SaveHeader> Header;
+                FString HeaderPath;
+        };
+
+        TArray<FItem> Items;
+        double WriteSeconds = 0.0;
+};
+
+struct UMO56SaveSubsystem::FSaveIndexScan
+{
+        /** A .sav whose size or timestamp no longer matches its index entry, so its header has to be read. */
+        struct FFile
+        {
+                FString SlotName;
+                FString HeaderPath;
+                int64 FileSize = 0;
+                FDateTime ModifiedUtc;
+                FMO56SaveHeader Header;
+                bool bHeaderRead = false;
+        };
+
+        FString Directory;
+
+        /** Copy of the index entries at launch, keyed by slot; the worker never touches CachedSaveIndex. */
+        TMap<FString, FSaveIndexEntry> PreviousEntries;
+
+        /** SaveIndexEditRevision at launch. A result taken before a later edit is thrown away and rescanned. */
+        uint32 EditRevision = 0;
+
+        TArray<FSaveIndexEntry> ReusedEntries;
+        TArray<FFile> FilesToRead;
+        TArray<FString> SkippedSlots;
+        int32 FilesFound = 0;
+        double ScanSeconds = 0.0;
+};
+
 static FGuid GuidFromString(const FString& S)
 {
         uint8 Digest[16];
@@ -145,6 +393,8 @@ void UMO56SaveSubsystem::Initialize(FSubsystemCollectionBase& Collection)
         FWorldDelegates::OnPostWorldInitialization.AddUObject(
                 this, &UMO56SaveSubsystem::HandlePostWorldInit);
 
+        RecoverInterruptedSaveWrites();
+
         LoadOrCreateSaveGame();
 
         UpdateOrRebuildSaveIndex(true);
@@ -154,6 +404,12 @@ void UMO56SaveSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
 void UMO56SaveSubsystem::Deinitialize()
 {
+        // The index is rebuilt on the next Initialize, so a scan still running is waited out and dropped.
+        SaveIndexScanTask.Wait();
+        InFlightSaveIndexScan.Reset();
+
+        FlushPendingSaveWrites();
+
         Super::Deinitialize();
 
         FWorldDelegates::OnPostWorldInitialization.RemoveAll(this);
@@ -186,11 +442,7 @@ void UMO56SaveSubsystem::Deinitialize()
         CurrentSaveGame = nullptr;
         LocalPlayerPersistentIds.Empty();
 
-        if (UWorld* World = GetWorld())
-        {
-                World->GetTimerManager().ClearTimer(AutosaveTimerHandle);
-        }
-
+        CancelAutosaveTicker();
         bAutosavePending = false;
         bPendingApplyOnNextLevel = false;
         bPendingCreateNewSaveAfterTravel = false;
@@ -254,12 +506,53 @@ bool UMO56SaveSubsystem::DoesSaveExist(const FGuid& SaveId) const
                 return false;
         }
 
-        return UGameplayStatics::DoesSaveGameExist(SlotName, ActiveSaveUserIndex);
+        return IsSaveWritePending(SlotName) || UGameplayStatics::DoesSaveGameExist(SlotName, ActiveSaveUserIndex);
 }
 
-UMO56SaveGame* UMO56SaveSubsystem::PeekSaveHeader(const FGuid& SaveId)
+bool UMO56SaveSubsystem::PeekSaveHeader(const FGuid& SaveId, FMO56SaveHeader& OutHeader)
 {
-        return ReadSave(SaveId, false);
+        return SaveId.IsValid() && ReadSaveHeader(MakeSlotName(SaveId), OutHeader);
+}
+
+bool UMO56SaveSubsystem::ReadSaveHeader(const FString& SlotName, FMO56SaveHeader& OutHeader)
+{
+        if (SlotName.IsEmpty())
+        {
+                return false;
+        }
+
+        if (IsSaveWritePending(SlotName))
+        {
+                FlushPendingSaveWrites();
+        }
+
+        const FString HeaderPath = GetSaveHeaderPath(SlotName);
+        const FDateTime SaveModifiedUtc = IFileManager::Get().GetTimeStamp(*FPaths::Combine(GetSaveDir(), SlotName + TEXT(".sav")));
+        if (ReadCurrentSaveHeaderFile(HeaderPath, SaveModifiedUtc, OutHeader))
+        {
+                return true;
+        }
+
+        // Saves written before headers existed, or whose header write was lost: read the body once and leave a
+        // current header behind for next time.
+        if (!UGameplayStatics::DoesSaveGameExist(SlotName, ActiveSaveUserIndex))
+        {
+                return false;
+        }
+
+        const UMO56SaveGame* SaveGame = Cast<UMO56SaveGame>(UGameplayStatics::LoadGameFromSlot(SlotName, ActiveSaveUserIndex));
+        if (!SaveGame)
+        {
+                return false;
+        }
+
+        OutHeader = MakeSaveHeader(*SaveGame);
+        if (WriteSaveHeaderFile(OutHeader, HeaderPath))
+        {
+                UE_LOG(LogMO56SaveSubsystem, Log, TEXT("Generated missing save header: %s"), *HeaderPath);
+        }
+
+        return true;
 }
 
 void UMO56SaveSubsystem::StartNewGame(const FString& LevelName)
@@ -421,16 +714,20 @@ bool UMO56SaveSubsystem::DeleteSave(const FGuid& SaveId)
                 return false;
         }
 
+        FlushPendingSaveWrites();
+
         const FString SlotName = MakeSlotName(SaveId);
         const bool bDeleted = UGameplayStatics::DeleteGameInSlot(SlotName, ActiveSaveUserIndex);
+        IFileManager::Get().Delete(*GetSaveHeaderPath(SlotName), false, true, true);
 
         if (bDeleted && CachedSaveIndex)
         {
+                ++SaveIndexEditRevision;
                 CachedSaveIndex->Entries.RemoveAll([&SaveId](const FSaveIndexEntry& Entry)
                 {
                         return Entry.SaveId == SaveId;
                 });
-                UGameplayStatics::SaveGameToSlot(CachedSaveIndex, SaveIndexSlotName, ActiveSaveUserIndex);
+                WriteSaveIndex();
         }
 
         return bDeleted;
@@ -450,6 +747,8 @@ bool UMO56SaveSubsystem::DeleteAllSaves(bool bAlsoDeleteIndex, bool bAlsoDeleteM
                 return false;
         }
 
+        FlushPendingSaveWrites();
+
         const FString SaveDir = FPaths::ProjectSavedDir() / TEXT("SaveGames");
         IFileManager& FM = IFileManager::Get();
 
@@ -482,11 +781,25 @@ bool UMO56SaveSubsystem::DeleteAllSaves(bool bAlsoDeleteIndex, bool bAlsoDeleteM
                 }
         }
 
+        TArray<FString> HeaderFiles;
+        FM.FindFiles(HeaderFiles, *(SaveDir / (FString(TEXT("*")) + SaveHeaderExtension)), true, false);
+        for (const FString& File : HeaderFiles)
+        {
+                FM.Delete(*(SaveDir / File), false, true, true);
+        }
+
         ActiveSaveId.Invalidate();
         CurrentSaveGame = nullptr;
         PendingLoadedSave = nullptr;
         bPendingApplyOnNextLevel = false;
 
+        // Nothing is left on disk to list, so don't show the old entries while the rescan runs.
+        if (CachedSaveIndex)
+        {
+                ++SaveIndexEditRevision;
+                CachedSaveIndex->Entries.Reset();
+        }
+
         UpdateOrRebuildSaveIndex(true);
 
         UE_LOG(LogMO56SaveSubsystem, Display, TEXT("DeleteAllSaves complete. Files deleted: %d"), Deleted);
@@ -518,20 +831,31 @@ bool UMO56SaveSubsystem::SaveGame(bool bForce)
                         UE_LOG(LogMO56SaveSubsystem, Verbose, TEXT("SaveGame skipped for world %s."), *World->GetMapName());
                         return false;
                 }
-
-                World->GetTimerManager().ClearTimer(AutosaveTimerHandle);
         }
 
+        CancelAutosaveTicker();
         bAutosavePending = false;
+        PendingAutosavePriority = EMO56AutosavePriority::Normal;
 
+        SaveRefreshStats = FSaveRefreshStats();
         RefreshInventorySaveData();
         RefreshTrackedPickups();
+        LastSaveRefreshStats = SaveRefreshStats;
 
         if (!CurrentSaveGame)
         {
                 return false;
         }
 
+        UE_LOG(LogMO56SaveSubsystem, Log, TEXT("SaveGame: refreshed Inventories=%d Characters=%d Pickups=%d; skipped %d unchanged (Inventories=%d Characters=%d Pickups=%d)"),
+                SaveRefreshStats.InventoriesWritten,
+                SaveRefreshStats.CharactersWritten,
+                SaveRefreshStats.PickupsWritten,
+                SaveRefreshStats.GetSkippedCount(),
+                SaveRefreshStats.InventoriesSkipped,
+                SaveRefreshStats.CharactersSkipped,
+                SaveRefreshStats.PickupsSkipped);
+
         const FDateTime NowUtc = FDateTime::UtcNow();
         if (CurrentSaveGame->CreatedUtc.GetTicks() == 0)
         {
@@ -555,12 +879,13 @@ bool UMO56SaveSubsystem::SaveGame(bool bForce)
         const bool bSaved = WriteSave(CurrentSaveGame);
         UE_LOG(LogMO56SaveSubsystem, Log, TEXT("SaveGame: Slot=%s Result=%s%s"),
                 *CurrentSaveGame->SlotName,
-                bSaved ? TEXT("Success") : TEXT("Failure"),
+                bSaved ? TEXT("Queued") : TEXT("Failure"),
                 bForce ? TEXT(" (forced)") : TEXT(""));
 
-        if (bSaved && CachedSaveIndex)
+        if (bSaved)
         {
-                UGameplayStatics::SaveGameToSlot(CachedSaveIndex, SaveIndexSlotName, ActiveSaveUserIndex);
+                WriteSaveIndex();
+                NoteSaveWritten();
         }
 
         return bSaved;
@@ -580,8 +905,11 @@ void UMO56SaveSubsystem::ResetToNewGame()
                 return;
         }
 
+        FlushPendingSaveWrites();
+
         const FString SlotName = ActiveSaveSlotName.IsEmpty() ? SaveSlotName : ActiveSaveSlotName;
         UGameplayStatics::DeleteGameInSlot(SlotName, ActiveSaveUserIndex);
+        IFileManager::Get().Delete(*GetSaveHeaderPath(SlotName), false, true, true);
 
         CurrentSaveGame = NewObject<UMO56SaveGame>(this);
         bAppliedPendingSaveThisLevel = false;
@@ -596,11 +924,7 @@ void UMO56SaveSubsystem::ResetToNewGame()
         CurrentSaveGame->Pawns.Empty();
         CurrentSaveGame->Assignments.Empty();
 
-        if (UWorld* World = GetWorld())
-        {
-                World->GetTimerManager().ClearTimer(AutosaveTimerHandle);
-        }
-
+        CancelAutosaveTicker();
         bAutosavePending = false;
 
         TArray<TWeakObjectPtr<AItemPickup>> PickupsToDestroy;
@@ -1115,6 +1439,11 @@ void UMO56SaveSubsystem::RegisterPlayerCharacter(AMO56Character* Character, AMO5
 
         ApplyCharacterStateFromSave(CharacterId);
         SyncPlayerSaveData(PlayerId);
+
+        if (RegisterContext == ERegisterPlayerCharacterContext::PossessionSwitch)
+        {
+                RequestAutosave(EMO56AutosavePriority::High);
+        }
 }
 
 void UMO56SaveSubsystem::NotifySkillComponentUpdated(USkillSystemComponent* SkillComponent)
@@ -1129,13 +1458,14 @@ void UMO56SaveSubsystem::NotifySkillComponentUpdated(USkillSystemComponent* Skil
                 if (CharacterIdPtr->IsValid())
                 {
                         RefreshCharacterSaveData(*CharacterIdPtr);
+                        RequestAutosave(EMO56AutosavePriority::Normal);
                 }
         }
 }
 
 void UMO56SaveSubsystem::RegisterWorldPickup(AItemPickup* Pickup)
 {
-        if (!Pickup)
+        if (!Pickup || Pickup->IsPooled())
         {
                 return;
         }
@@ -2117,6 +2447,12 @@ void UMO56SaveSubsystem::HandlePostWorldInit(UWorld* World, const UWorld::Initia
         FDelegateHandle SpawnHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &UMO56SaveSubsystem::HandleActorSpawned));
         WorldSpawnHandles.Add(World, SpawnHandle);
 
+        // Pickups reused from the pool never raise the actor-spawned event.
+        if (UItemPickupPoolSubsystem* PickupPool = World->GetSubsystem<UItemPickupPoolSubsystem>())
+        {
+                PickupPool->OnPickupActivated.AddUObject(this, &UMO56SaveSubsystem::RegisterWorldPickup);
+        }
+
         for (TActorIterator<AItemPickup> It(World); It; ++It)
         {
                 RegisterWorldPickup(*It);
@@ -2657,6 +2993,9 @@ void UMO56SaveSubsystem::HandlePickupSettled(AItemPickup* Pickup)
 
         TrackedPickups.Add(PickupId, Pickup);
         PickupToLevelMap.Add(PickupId, LevelName);
+
+        SyncDirtyTrackingWithCurrentSave();
+        CapturedPickupVersions.Add(PickupId, { Pickup, Pickup->GetSaveStateVersion() });
 }
 
 void UMO56SaveSubsystem::HandlePickupDestroyed(AItemPickup* Pickup)
@@ -2691,12 +3030,25 @@ void UMO56SaveSubsystem::HandlePickupDestroyed(AItemPickup* Pickup)
 
         TrackedPickups.Remove(PickupId);
         PickupToLevelMap.Remove(PickupId);
+        CapturedPickupVersions.Remove(PickupId);
 
         if (bIsApplyingSave)
         {
                 return;
         }
 
+        // A virtualized pickup only lost its actor; its DroppedItems entry now lives on in the world item store.
+        if (const UWorld* PickupWorld = Pickup->GetWorld())
+        {
+                if (const UMO56WorldItemStore* ItemStore = PickupWorld->GetSubsystem<UMO56WorldItemStore>())
+                {
+                        if (ItemStore->IsVirtualized(PickupId))
+                        {
+                                return;
+                        }
+                }
+        }
+
         if (LevelName.IsNone())
         {
                 return;
@@ -2811,6 +3163,12 @@ void UMO56SaveSubsystem::ApplySaveToWorld(UWorld* World)
                 return;
         }
 
+        // Store records are rebuilt from DroppedItems below, so anything from a previous session goes first.
+        if (UMO56WorldItemStore* ExistingStore = World->GetSubsystem<UMO56WorldItemStore>())
+        {
+                ExistingStore->Reset();
+        }
+
         const FName LevelName = ResolveLevelName(*World);
         if (LevelName.IsNone())
         {
@@ -2825,6 +3183,9 @@ void UMO56SaveSubsystem::ApplySaveToWorld(UWorld* World)
 
         TGuardValue<bool> ApplyingGuard(bIsApplyingSave, true);
 
+        // Virtualized drops stay data-only instead of spawning.
+        UMO56WorldItemStore* ItemStore = UMO56WorldItemStore::IsVirtualizationEnabled() ? World->GetSubsystem<UMO56WorldItemStore>() : nullptr;
+
         UE_LOG(LogMO56SaveSubsystem, Log, TEXT("ApplySaveToWorld: Begin Level=%s DroppedItems=%d Removed=%d"),
                 *LevelName.ToString(),
                 LevelState->DroppedItems.Num(),
@@ -2839,6 +3200,7 @@ void UMO56SaveSubsystem::ApplySaveToWorld(UWorld* World)
         int32 DestroyedCount = 0;
         int32 UpdatedCount = 0;
         int32 SpawnedCount = 0;
+        int32 VirtualizedCount = 0;
 
         for (TActorIterator<AItemPickup> It(World); It; ++It)
         {
@@ -2880,6 +3242,22 @@ void UMO56SaveSubsystem::ApplySaveToWorld(UWorld* World)
                 }
         }
 
+        // One batched async request for every world mesh about to be spawned; each pickup shows its placeholder
+        // until the batch lands instead of hitching on a blocking load per item type.
+        TArray<UItemData*> ItemsToSpawn;
+        for (const FWorldItemSaveData& SavedData : LevelState->DroppedItems)
+        {
+                if (PendingIds.Contains(SavedData.PickupId) && !(ItemStore && SavedData.bSpawnedFromInventory))
+                {
+                        if (UItemData* ItemData = Cast<UItemData>(SavedData.ItemPath.TryLoad()))
+                        {
+                                ItemsToSpawn.AddUnique(ItemData);
+                        }
+                }
+        }
+
+        const TSharedPtr<FStreamableHandle> VisualPrefetchHandle = AItemPickup::PrefetchItemVisuals(ItemsToSpawn);
+
         for (const FWorldItemSaveData& SavedData : LevelState->DroppedItems)
         {
                 if (!PendingIds.Contains(SavedData.PickupId))
@@ -2887,6 +3265,13 @@ void UMO56SaveSubsystem::ApplySaveToWorld(UWorld* World)
                         continue;
                 }
 
+                if (ItemStore && SavedData.bSpawnedFromInventory)
+                {
+                        ItemStore->AddRecord(SavedData);
+                        ++VirtualizedCount;
+                        continue;
+                }
+
                 UItemData* ItemData = Cast<UItemData>(SavedData.ItemPath.TryLoad());
                 if (!ItemData)
                 {
@@ -2919,10 +3304,11 @@ void UMO56SaveSubsystem::ApplySaveToWorld(UWorld* World)
                 ++SpawnedCount;
         }
 
-        UE_LOG(LogMO56SaveSubsystem, Log, TEXT("ApplySaveToWorld: Completed Level=%s Updated=%d Spawned=%d Destroyed=%d"),
+        UE_LOG(LogMO56SaveSubsystem, Log, TEXT("ApplySaveToWorld: Completed Level=%s Updated=%d Spawned=%d Virtualized=%d Destroyed=%d"),
                 *LevelName.ToString(),
                 UpdatedCount,
                 SpawnedCount,
+                VirtualizedCount,
                 DestroyedCount);
 }
 
@@ -2938,6 +3324,8 @@ void UMO56SaveSubsystem::RefreshInventorySaveData()
                 return;
         }
 
+        SyncDirtyTrackingWithCurrentSave();
+
         for (auto It = RegisteredInventories.CreateIterator(); It; ++It)
         {
                 const FGuid InventoryId = It.Key();
@@ -2945,15 +3333,14 @@ void UMO56SaveSubsystem::RefreshInventorySaveData()
                 if (!Inventory)
                 {
                         CurrentSaveGame->InventoryStates.Remove(InventoryId);
+                        CapturedInventoryVersions.Remove(InventoryId);
                         It.RemoveCurrent();
                         continue;
                 }
 
-                FInventorySaveData& SaveData = CurrentSaveGame->InventoryStates.FindOrAdd(InventoryId);
-                Inventory->WriteToSaveData(SaveData);
-
                 const FGuid OwnerId = InventoryOwnerIds.FindRef(Inventory);
-                EnsureInventoryOwnerMetadata(SaveData, OwnerId);
+                const bool bInventoryWritten = CaptureInventoryState(*Inventory, InventoryId, OwnerId);
+                ++(bInventoryWritten ? SaveRefreshStats.InventoriesWritten : SaveRefreshStats.InventoriesSkipped);
 
                 if (const EMO56InventoryOwner* OwnerTypePtr = InventoryOwnerTypes.Find(Inventory))
                 {
@@ -2962,7 +3349,15 @@ void UMO56SaveSubsystem::RefreshInventorySaveData()
                                 const FGuid CharacterOwnerId = InventoryOwnerIds.FindRef(Inventory);
                                 if (CharacterOwnerId.IsValid())
                                 {
-                                        RefreshCharacterSaveData(CharacterOwnerId);
+                                        if (bInventoryWritten || IsCharacterSaveDirty(CharacterOwnerId))
+                                        {
+                                                RefreshCharacterSaveData(CharacterOwnerId);
+                                                ++SaveRefreshStats.CharactersWritten;
+                                        }
+                                        else
+                                        {
+                                                ++SaveRefreshStats.CharactersSkipped;
+                                        }
                                 }
                         }
                 }
@@ -2983,16 +3378,29 @@ void UMO56SaveSubsystem::RefreshTrackedPickups()
                 return;
         }
 
+        SyncDirtyTrackingWithCurrentSave();
+
         for (auto It = TrackedPickups.CreateIterator(); It; ++It)
         {
                 const FGuid PickupId = It.Key();
                 AItemPickup* Pickup = It.Value().Get();
                 if (!Pickup)
                 {
+                        CapturedPickupVersions.Remove(PickupId);
                         It.RemoveCurrent();
                         continue;
                 }
 
+                const uint32 PickupVersion = Pickup->GetSaveStateVersion();
+                if (const FCapturedVersion* CapturedVersion = CapturedPickupVersions.Find(PickupId))
+                {
+                        if (CapturedVersion->Matches(Pickup, PickupVersion))
+                        {
+                                ++SaveRefreshStats.PickupsSkipped;
+                                continue;
+                        }
+                }
+
                 FName LevelName = ResolveLevelName(*Pickup);
                 if (LevelName.IsNone())
                 {
@@ -3024,94 +3432,232 @@ void UMO56SaveSubsystem::RefreshTrackedPickups()
                 Entry->Transform = Pickup->GetActorTransform();
                 Entry->Quantity = Pickup->GetQuantity();
                 Entry->bSpawnedFromInventory = Pickup->WasSpawnedFromInventory();
+
+                CapturedPickupVersions.Add(PickupId, { Pickup, PickupVersion });
+                ++SaveRefreshStats.PickupsWritten;
         }
+
+        RefreshVirtualizedPickups();
 }
 
-FName UMO56SaveSubsystem::ResolveLevelName(const AActor& Actor) const
+void UMO56SaveSubsystem::RefreshVirtualizedPickups()
 {
-        if (const ULevel* Level = Actor.GetLevel())
+        UWorld* World = GetWorld();
+        const UMO56WorldItemStore* ItemStore = World ? World->GetSubsystem<UMO56WorldItemStore>() : nullptr;
+        if (!ItemStore || ItemStore->GetRecords().Num() == 0)
         {
-                if (const UPackage* Package = Level->GetOutermost())
-                {
-                        return Package->GetFName();
-                }
+                return;
         }
 
-        if (const UWorld* World = Actor.GetWorld())
+        if (CapturedItemStore.Get() == ItemStore && CapturedItemStoreRevision == ItemStore->GetRecordsRevision())
         {
-                return ResolveLevelName(*World);
+                SaveRefreshStats.PickupsSkipped += ItemStore->GetRecords().Num();
+                return;
         }
 
-        return NAME_None;
-}
+        const FName LevelName = ResolveLevelName(*World);
+        if (LevelName.IsNone())
+        {
+                return;
+        }
 
-FName UMO56SaveSubsystem::ResolveLevelName(const UWorld& World) const
-{
-        if (const UPackage* Package = World.GetOutermost())
+        FLevelWorldState& LevelState = CurrentSaveGame->LevelStates.FindOrAdd(LevelName);
+
+        TMap<FGuid, int32> EntryIndices;
+        EntryIndices.Reserve(LevelState.DroppedItems.Num());
+        for (int32 Index = 0; Index < LevelState.DroppedItems.Num(); ++Index)
         {
-                return Package->GetFName();
+                EntryIndices.Add(LevelState.DroppedItems[Index].PickupId, Index);
         }
 
-        return NAME_None;
-}
+        for (const TPair<FGuid, FWorldItemSaveData>& Pair : ItemStore->GetRecords())
+        {
+                if (const int32* Index = EntryIndices.Find(Pair.Key))
+                {
+                        LevelState.DroppedItems[*Index] = Pair.Value;
+                }
+                else
+                {
+                        LevelState.DroppedItems.Add(Pair.Value);
+                }
+        }
 
-void UMO56SaveSubsystem::BindPickupDelegates(AItemPickup& Pickup)
-{
-        Pickup.OnDropSettled.AddUniqueDynamic(this, &UMO56SaveSubsystem::HandlePickupSettled);
-        Pickup.OnPickupDestroyed.AddUniqueDynamic(this, &UMO56SaveSubsystem::HandlePickupDestroyed);
+        SaveRefreshStats.PickupsWritten += ItemStore->GetRecords().Num();
+        CapturedItemStore = ItemStore;
+        CapturedItemStoreRevision = ItemStore->GetRecordsRevision();
 }
 
-void UMO56SaveSubsystem::UnbindPickupDelegates(AItemPickup& Pickup)
+void UMO56SaveSubsystem::SyncDirtyTrackingWithCurrentSave()
 {
-        Pickup.OnDropSettled.RemoveDynamic(this, &UMO56SaveSubsystem::HandlePickupSettled);
-        Pickup.OnPickupDestroyed.RemoveDynamic(this, &UMO56SaveSubsystem::HandlePickupDestroyed);
+        if (DirtyTrackingSave.Get() == CurrentSaveGame)
+        {
+                return;
+        }
+
+        DirtyTrackingSave = CurrentSaveGame;
+        CapturedInventoryVersions.Reset();
+        CapturedCharacterStates.Reset();
+        CapturedPickupVersions.Reset();
+        CapturedItemStore.Reset();
+        CapturedItemStoreRevision = 0;
 }
 
-bool UMO56SaveSubsystem::ApplyLoadedSaveGame(UMO56SaveGame* LoadedSave)
+bool UMO56SaveSubsystem::CaptureInventoryState(UInventoryComponent& Inventory, const FGuid& InventoryId, const FGuid& OwnerId)
 {
-        if (!LoadedSave)
-        {
-                return false;
-        }
+        SyncDirtyTrackingWithCurrentSave();
 
-        if (!IsAuthoritative())
+        const uint32 Version = Inventory.GetContentVersion();
+        FInventorySaveData* Existing = CurrentSaveGame->InventoryStates.Find(InventoryId);
+        const FCapturedVersion* CapturedVersion = CapturedInventoryVersions.Find(InventoryId);
+        const bool bUnchanged = Existing && CapturedVersion && CapturedVersion->Matches(&Inventory, Version);
+
+        FInventorySaveData& SaveData = Existing ? *Existing : CurrentSaveGame->InventoryStates.Add(InventoryId);
+        if (!bUnchanged)
         {
-                return false;
+                Inventory.WriteToSaveData(SaveData);
+                CapturedInventoryVersions.Add(InventoryId, { &Inventory, Version });
         }
 
-        SanitizeLoadedSave(*LoadedSave);
-        CacheSaveMetadata(*LoadedSave);
-        CurrentSaveGame = LoadedSave;
-
-        ApplySaveToInventories();
-
-        UE_LOG(LogMO56SaveSubsystem, Log, TEXT("LoadGame: success"));
-        return true;
+        EnsureInventoryOwnerMetadata(SaveData, OwnerId);
+        return !bUnchanged;
 }
 
-bool UMO56SaveSubsystem::ApplyPendingSave(UWorld& World)
+bool UMO56SaveSubsystem::IsCharacterSaveDirty(const FGuid& CharacterId) const
 {
-        if (!IsAuthoritative())
+        const FCapturedCharacterState* Captured = CapturedCharacterStates.Find(CharacterId);
+        if (!Captured || !CurrentSaveGame || !CurrentSaveGame->CharacterStates.Contains(CharacterId))
         {
-                return false;
+                return true;
         }
 
-        if (!bPendingApplyOnNextLevel || !PendingLoadedSave)
+        // Mirrors where RefreshCharacterSaveData reads the transform from: the registered character wins over the inventory owner.
+        const AMO56Character* Character = nullptr;
+        if (const TWeakObjectPtr<AMO56Character>* CharacterPtr = RegisteredCharacters.Find(CharacterId))
         {
-                return false;
+                Character = CharacterPtr->Get();
         }
 
-        const FString MapName = UWorld::RemovePIEPrefix(World.GetMapName());
-        FString MapShortName = FPackageName::GetShortName(MapName);
-        if (MapShortName.IsEmpty())
+        const AActor* TransformSource = Character;
+        if (!TransformSource)
         {
-                MapShortName = MapName;
+                if (const TWeakObjectPtr<UInventoryComponent>* InventoryPtr = CharacterToInventoryComponent.Find(CharacterId))
+                {
+                        if (const UInventoryComponent* Inventory = InventoryPtr->Get())
+                        {
+                                TransformSource = Cast<APawn>(Inventory->GetOwner());
+                        }
+                }
         }
 
-        UE_LOG(LogMO56SaveSubsystem, Log, TEXT("ApplyPendingSave: Begin World=%s SaveId=%s"),
-                *MapShortName,
-                PendingLoadedSave->SaveId.IsValid() ? *PendingLoadedSave->SaveId.ToString() : TEXT("None"));
-
+        if (TransformSource && !TransformSource->GetActorTransform().Equals(Captured->Transform))
+        {
+                return true;
+        }
+
+        if (Character && Captured->Controller.Get() != Character->GetController())
+        {
+                return true;
+        }
+
+        if (const TWeakObjectPtr<USkillSystemComponent>* SkillPtr = CharacterToSkillComponent.Find(CharacterId))
+        {
+                if (const USkillSystemComponent* Skill = SkillPtr->Get())
+                {
+                        if (!Captured->Skill.Matches(Skill, Skill->GetSaveStateVersion()))
+                        {
+                                return true;
+                        }
+                }
+        }
+
+        return false;
+}
+
+FName UMO56SaveSubsystem::ResolveLevelName(const AActor& Actor) const
+{
+        if (const ULevel* Level = Actor.GetLevel())
+        {
+                if (const UPackage* Package = Level->GetOutermost())
+                {
+                        return Package->GetFName();
+                }
+        }
+
+        if (const UWorld* World = Actor.GetWorld())
+        {
+                return ResolveLevelName(*World);
+        }
+
+        return NAME_None;
+}
+
+FName UMO56SaveSubsystem::ResolveLevelName(const UWorld& World) const
+{
+        if (const UPackage* Package = World.GetOutermost())
+        {
+                return Package->GetFName();
+        }
+
+        return NAME_None;
+}
+
+void UMO56SaveSubsystem::BindPickupDelegates(AItemPickup& Pickup)
+{
+        Pickup.OnDropSettled.AddUniqueDynamic(this, &UMO56SaveSubsystem::HandlePickupSettled);
+        Pickup.OnPickupDestroyed.AddUniqueDynamic(this, &UMO56SaveSubsystem::HandlePickupDestroyed);
+}
+
+void UMO56SaveSubsystem::UnbindPickupDelegates(AItemPickup& Pickup)
+{
+        Pickup.OnDropSettled.RemoveDynamic(this, &UMO56SaveSubsystem::HandlePickupSettled);
+        Pickup.OnPickupDestroyed.RemoveDynamic(this, &UMO56SaveSubsystem::HandlePickupDestroyed);
+}
+
+bool UMO56SaveSubsystem::ApplyLoadedSaveGame(UMO56SaveGame* LoadedSave)
+{
+        if (!LoadedSave)
+        {
+                return false;
+        }
+
+        if (!IsAuthoritative())
+        {
+                return false;
+        }
+
+        SanitizeLoadedSave(*LoadedSave);
+        CacheSaveMetadata(*LoadedSave);
+        CurrentSaveGame = LoadedSave;
+
+        ApplySaveToInventories();
+
+        UE_LOG(LogMO56SaveSubsystem, Log, TEXT("LoadGame: success"));
+        return true;
+}
+
+bool UMO56SaveSubsystem::ApplyPendingSave(UWorld& World)
+{
+        if (!IsAuthoritative())
+        {
+                return false;
+        }
+
+        if (!bPendingApplyOnNextLevel || !PendingLoadedSave)
+        {
+                return false;
+        }
+
+        const FString MapName = UWorld::RemovePIEPrefix(World.GetMapName());
+        FString MapShortName = FPackageName::GetShortName(MapName);
+        if (MapShortName.IsEmpty())
+        {
+                MapShortName = MapName;
+        }
+
+        UE_LOG(LogMO56SaveSubsystem, Log, TEXT("ApplyPendingSave: Begin World=%s SaveId=%s"),
+                *MapShortName,
+                PendingLoadedSave->SaveId.IsValid() ? *PendingLoadedSave->SaveId.ToString() : TEXT("None"));
+
         PendingLoadedSave->LevelName = MapShortName;
         PendingLoadedSave->bIsGameplaySave = true;
         PendingLevelName = MapShortName;
@@ -3276,7 +3822,7 @@ FString UMO56SaveSubsystem::GenerateUniqueSaveSlotName() const
         FString Candidate = BaseName;
         int32 Counter = 1;
 
-        while (UGameplayStatics::DoesSaveGameExist(Candidate, ActiveSaveUserIndex))
+        while (IsSaveWritePending(Candidate) || UGameplayStatics::DoesSaveGameExist(Candidate, ActiveSaveUserIndex))
         {
                 Candidate = FString::Printf(TEXT("%s_%d"), *BaseName, Counter++);
         }
@@ -3299,6 +3845,8 @@ bool UMO56SaveSubsystem::LoadGameBySlot(const FString& SlotName, int32 UserIndex
 
         const int32 TargetUserIndex = UserIndex >= 0 ? UserIndex : ActiveSaveUserIndex;
 
+        FlushPendingSaveWrites();
+
         USaveGame* Loaded = UGameplayStatics::LoadGameFromSlot(SlotName, TargetUserIndex);
         if (!Loaded)
         {
@@ -3342,7 +3890,7 @@ TArray<FSaveGameSummary> UMO56SaveSubsystem::GetAvailableSaveSummaries() const
 
         if (UMO56SaveSubsystem* MutableThis = const_cast<UMO56SaveSubsystem*>(this))
         {
-                const TArray<FSaveIndexEntry> Entries = MutableThis->ListSaves();
+                const TArray<FSaveIndexEntry> Entries = MutableThis->ListSaves(false);
                 for (const FSaveIndexEntry& Entry : Entries)
                 {
                         FSaveGameSummary Summary;
@@ -3355,13 +3903,14 @@ TArray<FSaveGameSummary> UMO56SaveSubsystem::GetAvailableSaveSummaries() const
                         Summary.InventoryCount = 0;
                         Summary.SaveId = Entry.SaveId;
 
-                        if (UMO56SaveGame* Header = MutableThis->PeekSaveHeader(Entry.SaveId))
+                        FMO56SaveHeader Header;
+                        if (MutableThis->PeekSaveHeader(Entry.SaveId, Header))
                         {
-                                Summary.InitialSaveTimestamp = Header->CreatedUtc;
-                                Summary.LastSaveTimestamp = Header->UpdatedUtc;
-                                Summary.TotalPlayTimeSeconds = Header->TotalPlayTimeSeconds;
-                                Summary.LastLevelName = Header->LevelName.IsEmpty() ? NAME_None : FName(*Header->LevelName);
-                                Summary.InventoryCount = Header->InventoryStates.Num();
+                                Summary.InitialSaveTimestamp = Header.CreatedUtc;
+                                Summary.LastSaveTimestamp = Header.UpdatedUtc;
+                                Summary.TotalPlayTimeSeconds = Header.TotalPlaySeconds;
+                                Summary.LastLevelName = Header.LevelName.IsEmpty() ? NAME_None : FName(*Header.LevelName);
+                                Summary.InventoryCount = Header.InventoryCount;
                         }
 
                         Result.Add(MoveTemp(Summary));
@@ -3372,32 +3921,138 @@ TArray<FSaveGameSummary> UMO56SaveSubsystem::GetAvailableSaveSummaries() const
 }
 
 void UMO56SaveSubsystem::HandleInventoryComponentUpdated()
+{
+        RequestAutosave(EMO56AutosavePriority::Normal);
+}
+
+void UMO56SaveSubsystem::RequestAutosave(EMO56AutosavePriority Priority)
 {
         if (bIsApplyingSave || !IsAuthoritative())
         {
                 return;
         }
 
-        if (bAutosavePending)
+        UWorld* World = GetWorld();
+        if (!World || !CanAutosaveInWorld(*World))
         {
                 return;
         }
 
-        if (UWorld* World = GetWorld())
+        const double NowSeconds = FPlatformTime::Seconds();
+        if (!bAutosavePending)
         {
-                if (!CanAutosaveInWorld(*World))
-                {
-                        return;
-                }
+                bAutosavePending = true;
+                FirstUnsavedChangeSeconds = NowSeconds;
+                PendingAutosavePriority = Priority;
+        }
+        else if (Priority > PendingAutosavePriority)
+        {
+                PendingAutosavePriority = Priority;
+        }
 
-                FTimerManager& TimerManager = World->GetTimerManager();
-                if (!TimerManager.IsTimerActive(AutosaveTimerHandle))
-                {
-                        TimerManager.SetTimer(AutosaveTimerHandle, this, &UMO56SaveSubsystem::HandleAutosaveTimerElapsed, AutosaveDelaySeconds, false);
-                }
+        LastUnsavedChangeSeconds = NowSeconds;
+        ScheduleAutosave();
+}
 
-                bAutosavePending = true;
+void UMO56SaveSubsystem::ScheduleAutosave()
+{
+        const double NowSeconds = FPlatformTime::Seconds();
+        AutosaveDueSeconds = ComputeAutosaveDueSeconds(NowSeconds);
+
+        // The core ticker runs on real time while the world is paused or dilated; due-now saves wait for its next tick.
+        CancelAutosaveTicker();
+        const float DelaySeconds = FMath::Max(0.f, static_cast<float>(AutosaveDueSeconds - NowSeconds));
+        AutosaveTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+                FTickerDelegate::CreateUObject(this, &UMO56SaveSubsystem::HandleAutosaveTick), DelaySeconds);
+}
+
+void UMO56SaveSubsystem::CancelAutosaveTicker()
+{
+        if (AutosaveTickerHandle.IsValid())
+        {
+                FTSTicker::GetCoreTicker().RemoveTicker(AutosaveTickerHandle);
+                AutosaveTickerHandle.Reset();
+        }
+}
+
+double UMO56SaveSubsystem::ComputeAutosaveDueSeconds(double NowSeconds) const
+{
+        const double MaxDataLoss = FMath::Max(1.f, CVarAutosaveMaxDataLossSeconds.GetValueOnGameThread());
+        const double MinInterval = FMath::Clamp<double>(CVarAutosaveMinIntervalSeconds.GetValueOnGameThread(), 0.0, MaxDataLoss);
+        const double Coalesce = FMath::Clamp<double>(CVarAutosaveCoalesceSeconds.GetValueOnGameThread(), 0.0, MaxDataLoss);
+        const double Deadline = FirstUnsavedChangeSeconds + MaxDataLoss;
+
+        double DueSeconds = NowSeconds;
+        if (PendingAutosavePriority == EMO56AutosavePriority::Normal)
+        {
+                DueSeconds = FMath::Min(LastUnsavedChangeSeconds + Coalesce, Deadline);
+                DueSeconds = FMath::Min(FMath::Max(DueSeconds, GetSaveBudgetAvailableSeconds(NowSeconds)), Deadline);
+        }
+
+        // The last write predates the first unsaved change, so with MinInterval <= MaxDataLoss this never pushes past Deadline.
+        if (bHasWrittenSave)
+        {
+                DueSeconds = FMath::Max(DueSeconds, LastSaveWriteSeconds + MinInterval);
         }
+
+        return DueSeconds;
+}
+
+double UMO56SaveSubsystem::GetSaveBudgetAvailableSeconds(double NowSeconds) const
+{
+        constexpr double BudgetWindowSeconds = 60.0;
+        const int32 MaxWrites = CVarAutosaveMaxWritesPerMinute.GetValueOnGameThread();
+        if (MaxWrites <= 0)
+        {
+                return NowSeconds;
+        }
+
+        const int32 FirstInWindow = Algo::LowerBound(RecentSaveWriteSeconds, NowSeconds - BudgetWindowSeconds);
+        const int32 WritesInWindow = RecentSaveWriteSeconds.Num() - FirstInWindow;
+        if (WritesInWindow < MaxWrites)
+        {
+                return NowSeconds;
+        }
+
+        // The budget frees up once the oldest write that keeps it exhausted leaves the window.
+        return RecentSaveWriteSeconds[RecentSaveWriteSeconds.Num() - MaxWrites] + BudgetWindowSeconds;
+}
+
+void UMO56SaveSubsystem::NoteSaveWritten()
+{
+        const double NowSeconds = FPlatformTime::Seconds();
+        LastSaveWriteSeconds = NowSeconds;
+        bHasWrittenSave = true;
+
+        RecentSaveWriteSeconds.Add(NowSeconds);
+        const int32 FirstInWindow = Algo::LowerBound(RecentSaveWriteSeconds, NowSeconds - 60.0);
+        RecentSaveWriteSeconds.RemoveAt(0, FirstInWindow, EAllowShrinking::No);
+}
+
+FString UMO56SaveSubsystem::DescribeAutosaveState() const
+{
+        const double NowSeconds = FPlatformTime::Seconds();
+        const int32 FirstInWindow = Algo::LowerBound(RecentSaveWriteSeconds, NowSeconds - 60.0);
+
+        FString State = bAutosavePending
+                ? FString::Printf(TEXT("Pending (%s) unsaved for %.1fs, last change %.1fs ago, due in %.1fs"),
+                        PendingAutosavePriority == EMO56AutosavePriority::High ? TEXT("High") : TEXT("Normal"),
+                        NowSeconds - FirstUnsavedChangeSeconds,
+                        NowSeconds - LastUnsavedChangeSeconds,
+                        FMath::Max(0.0, AutosaveDueSeconds - NowSeconds))
+                : FString(TEXT("Idle"));
+
+        State += FString::Printf(TEXT(" | LastWrite=%s WritesLastMinute=%d/%d InFlight=%s LastSkipped=%d | Coalesce=%.1fs MaxDataLoss=%.1fs MinInterval=%.1fs"),
+                bHasWrittenSave ? *FString::Printf(TEXT("%.1fs ago"), NowSeconds - LastSaveWriteSeconds) : TEXT("never"),
+                RecentSaveWriteSeconds.Num() - FirstInWindow,
+                CVarAutosaveMaxWritesPerMinute.GetValueOnGameThread(),
+                HasPendingSaveWrites() ? TEXT("yes") : TEXT("no"),
+                LastSaveRefreshStats.GetSkippedCount(),
+                CVarAutosaveCoalesceSeconds.GetValueOnGameThread(),
+                CVarAutosaveMaxDataLossSeconds.GetValueOnGameThread(),
+                CVarAutosaveMinIntervalSeconds.GetValueOnGameThread());
+
+        return State;
 }
 
 void UMO56SaveSubsystem::HandleInventoryRegistered(UInventoryComponent* InventoryComponent, EMO56InventoryOwner OwnerType, const FGuid& OwnerId)
@@ -3586,25 +4241,32 @@ void UMO56SaveSubsystem::HandleSkillComponentRegistered(USkillSystemComponent* S
         ApplyCharacterStateFromSave(CharacterId);
 }
 
-void UMO56SaveSubsystem::HandleAutosaveTimerElapsed()
+bool UMO56SaveSubsystem::HandleAutosaveTick(float DeltaTime)
 {
-        bAutosavePending = false;
+        // One-shot: returning false retires this ticker, and any reschedule below registers a fresh one.
+        AutosaveTickerHandle.Reset();
 
-        if (!IsAuthoritative())
+        if (!bAutosavePending)
         {
-                return;
+                return false;
         }
 
-        if (UWorld* World = GetWorld())
+        UWorld* World = GetWorld();
+        if (!IsAuthoritative() || !World || !CanAutosaveInWorld(*World))
         {
-                if (!CanAutosaveInWorld(*World))
-                {
-                        return;
-                }
+                bAutosavePending = false;
+                return false;
+        }
+
+        // A manual save or a policy change since the ticker was armed can move the due time later.
+        if (ComputeAutosaveDueSeconds(FPlatformTime::Seconds()) > FPlatformTime::Seconds() + 0.05)
+        {
+                ScheduleAutosave();
+                return false;
         }
 
-        RefreshInventorySaveData();
         SaveGame();
+        return false;
 }
 
 
@@ -3699,19 +4361,217 @@ FString UMO56SaveSubsystem::GetSaveDir() const
         return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("SaveGames"));
 }
 
-bool UMO56SaveSubsystem::IsSaveFileName(const FString& Name) const
+FString UMO56SaveSubsystem::GetSaveHeaderPath(const FString& SlotName) const
+{
+        return FPaths::Combine(GetSaveDir(), SlotName + SaveHeaderExtension);
+}
+
+bool UMO56SaveSubsystem::IsSaveFileName(const FString& Name)
 {
         return Name.StartsWith(TEXT("MO56_")) && Name.EndsWith(TEXT(".sav"));
 }
 
 bool UMO56SaveSubsystem::WriteSave(const UMO56SaveGame* Data)
 {
-        if (!Data)
+        if (!Data || Data->SlotName.IsEmpty())
         {
                 return false;
         }
 
-        return UGameplayStatics::SaveGameToSlot(const_cast<UMO56SaveGame*>(Data), Data->SlotName, ActiveSaveUserIndex);
+        QueueSaveWrite(Data->SlotName, *Data);
+        return true;
+}
+
+void UMO56SaveSubsystem::WriteSaveIndex()
+{
+        if (CachedSaveIndex)
+        {
+                QueueSaveWrite(SaveIndexSlotName, *CachedSaveIndex);
+        }
+}
+
+void UMO56SaveSubsystem::QueueSaveWrite(const FString& SlotName, const USaveGame& Source)
+{
+        QueuedSaveWrites.Add(SlotName, MakeSaveSnapshot(Source));
+
+        if (!InFlightSaveWriteBatch)
+        {
+                StartNextSaveWriteBatch();
+        }
+}
+
+void UMO56SaveSubsystem::StartNextSaveWriteBatch()
+{
+        check(IsInGameThread());
+
+        if (InFlightSaveWriteBatch || QueuedSaveWrites.Num() == 0)
+        {
+                return;
+        }
+
+        TSharedPtr<FSaveWriteBatch> Batch = MakeShared<FSaveWriteBatch>();
+        Batch->Items.Reserve(QueuedSaveWrites.Num());
+        InFlightSaveSnapshots.Reset();
+
+        const FString SaveDir = GetSaveDir();
+        for (const TPair<FString, TObjectPtr<USaveGame>>& Pair : QueuedSaveWrites)
+        {
+                FSaveWriteBatch::FItem& Item = Batch->Items.AddDefaulted_GetRef();
+                Item.SlotName = Pair.Key;
+                Item.FilePath = FPaths::Combine(SaveDir, Pair.Key + TEXT(".sav"));
+                Item.Snapshot = Pair.Value;
+                InFlightSaveSnapshots.Add(Pair.Value);
+
+                if (const UMO56SaveGame* SaveSnapshot = Cast<UMO56SaveGame>(Pair.Value))
+                {
+                        Item.Header = MakeSaveHeader(*SaveSnapshot);
+                        Item.HeaderPath = GetSaveHeaderPath(Pair.Key);
+                }
+        }
+
+        QueuedSaveWrites.Reset();
+        InFlightSaveWriteBatch = Batch;
+
+        auto WriteBatch = [Batch]()
+        {
+                const double StartSeconds = FPlatformTime::Seconds();
+                for (FSaveWriteBatch::FItem& Item : Batch->Items)
+                {
+                        Item.bSucceeded = WriteSaveSnapshotToDisk(Item.Snapshot, Item.FilePath);
+
+                        // A missing or stale header only costs a full read the next time the menu lists this save.
+                        if (Item.bSucceeded && Item.Header.IsSet() && !WriteSaveHeaderFile(Item.Header.GetValue(), Item.HeaderPath))
+                        {
+                                UE_LOG(LogMO56SaveSubsystem, Warning, TEXT("Save header write failed: %s"), *Item.HeaderPath);
+                        }
+                }
+                Batch->WriteSeconds = FPlatformTime::Seconds() - StartSeconds;
+        };
+
+        if (CVarSaveAsyncWrites.GetValueOnGameThread() == 0)
+        {
+                WriteBatch();
+                CompleteSaveWriteBatch(Batch);
+                return;
+        }
+
+        TWeakObjectPtr<UMO56SaveSubsystem> WeakThis(this);
+        SaveWriteTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [WriteBatch, WeakThis, Batch]()
+        {
+                WriteBatch();
+
+                AsyncTask(ENamedThreads::GameThread, [WeakThis, Batch]()
+                {
+                        if (UMO56SaveSubsystem* This = WeakThis.Get())
+                        {
+                                This->CompleteSaveWriteBatch(Batch);
+                        }
+                });
+        });
+}
+
+void UMO56SaveSubsystem::CompleteSaveWriteBatch(const TSharedPtr<FSaveWriteBatch>& Batch)
+{
+        check(IsInGameThread());
+
+        // FlushPendingSaveWrites may already have completed this batch before the game-thread callback ran.
+        if (!Batch || Batch != InFlightSaveWriteBatch)
+        {
+                return;
+        }
+
+        InFlightSaveWriteBatch.Reset();
+        InFlightSaveSnapshots.Reset();
+
+        for (const FSaveWriteBatch::FItem& Item : Batch->Items)
+        {
+                if (Item.bSucceeded)
+                {
+                        UE_LOG(LogMO56SaveSubsystem, Verbose, TEXT("Save write committed: %s"), *Item.FilePath);
+                }
+                else
+                {
+                        UE_LOG(LogMO56SaveSubsystem, Error, TEXT("Save write failed: %s"), *Item.FilePath);
+                }
+        }
+
+        UE_LOG(LogMO56SaveSubsystem, Log, TEXT("Wrote %d save slot(s) in %.2f ms"), Batch->Items.Num(), Batch->WriteSeconds * 1000.0);
+
+        for (const FSaveWriteBatch::FItem& Item : Batch->Items)
+        {
+                OnSaveWriteCompleted.Broadcast(Item.SlotName, Item.bSucceeded);
+        }
+
+        StartNextSaveWriteBatch();
+}
+
+void UMO56SaveSubsystem::FlushPendingSaveWrites()
+{
+        check(IsInGameThread());
+
+        while (InFlightSaveWriteBatch)
+        {
+                SaveWriteTask.Wait();
+                CompleteSaveWriteBatch(InFlightSaveWriteBatch);
+        }
+}
+
+bool UMO56SaveSubsystem::HasPendingSaveWrites() const
+{
+        return InFlightSaveWriteBatch.IsValid() || QueuedSaveWrites.Num() > 0;
+}
+
+bool UMO56SaveSubsystem::IsSaveWritePending(const FString& SlotName) const
+{
+        if (QueuedSaveWrites.Contains(SlotName))
+        {
+                return true;
+        }
+
+        return InFlightSaveWriteBatch && InFlightSaveWriteBatch->Items.ContainsByPredicate([&SlotName](const FSaveWriteBatch::FItem& Item)
+        {
+                return Item.SlotName == SlotName;
+        });
+}
+
+void UMO56SaveSubsystem::RecoverInterruptedSaveWrites()
+{
+        const FString SaveDir = GetSaveDir();
+        IFileManager& FileManager = IFileManager::Get();
+
+        // Headers are rebuilt on demand, so an interrupted header write is simply dropped.
+        TArray<FString> HeaderTempFiles;
+        FileManager.FindFiles(HeaderTempFiles, *(SaveDir / (FString(TEXT("*")) + SaveHeaderExtension + SaveTempFileSuffix)), true, false);
+        for (const FString& HeaderTempFile : HeaderTempFiles)
+        {
+                FileManager.Delete(*(SaveDir / HeaderTempFile), false, true, true);
+        }
+
+        TArray<FString> TempFiles;
+        FileManager.FindFiles(TempFiles, *(SaveDir / (FString(TEXT("*.sav")) + SaveTempFileSuffix)), true, false);
+
+        for (const FString& TempFile : TempFiles)
+        {
+                const FString TempPath = SaveDir / TempFile;
+                const FString FinalPath = TempPath.LeftChop(FCString::Strlen(SaveTempFileSuffix));
+
+                // A temp file next to a live save was cut short mid-write; one without a live save was fully
+                // written but the process died between replacing the old file and renaming this one.
+                TArray<uint8> Bytes;
+                const bool bPromote = !FileManager.FileExists(*FinalPath)
+                        && FFileHelper::LoadFileToArray(Bytes, *TempPath)
+                        && UGameplayStatics::LoadGameFromMemory(Bytes) != nullptr;
+
+                if (bPromote && FileManager.Move(*FinalPath, *TempPath, false, true))
+                {
+                        UE_LOG(LogMO56SaveSubsystem, Warning, TEXT("Recovered interrupted save write: %s"), *FinalPath);
+                }
+                else
+                {
+                        FileManager.Delete(*TempPath, false, true, true);
+                        UE_LOG(LogMO56SaveSubsystem, Log, TEXT("Discarded incomplete save write: %s"), *TempPath);
+                }
+        }
 }
 
 UMO56SaveGame* UMO56SaveSubsystem::ReadSave(const FGuid& SaveId, bool bUpdateMetadata)
@@ -3722,6 +4582,11 @@ UMO56SaveGame* UMO56SaveSubsystem::ReadSave(const FGuid& SaveId, bool bUpdateMet
         }
 
         const FString SlotName = MakeSlotName(SaveId);
+        if (IsSaveWritePending(SlotName))
+        {
+                FlushPendingSaveWrites();
+        }
+
         if (UGameplayStatics::DoesSaveGameExist(SlotName, ActiveSaveUserIndex))
         {
                 if (USaveGame* Loaded = UGameplayStatics::LoadGameFromSlot(SlotName, ActiveSaveUserIndex))
@@ -3781,88 +4646,219 @@ void UMO56SaveSubsystem::UpdateOrRebuildSaveIndex(bool bForceRebuild)
                 return;
         }
 
-        const FString Directory = GetSaveDir();
-        IFileManager::Get().MakeDirectory(*Directory, true);
+        // A scan already running may have listed the directory before the change that asked for this one.
+        if (InFlightSaveIndexScan)
+        {
+                bSaveIndexRescanRequested = true;
+                return;
+        }
 
-        TArray<FString> SkippedSlots;
-        int32 FilesFound = 0;
-        int32 AddedEntries = 0;
-        const FGuid PreviousActiveSaveId = ActiveSaveId;
-        const FString PreviousActiveSlotName = ActiveSaveSlotName;
+        StartSaveIndexScan();
+}
+
+void UMO56SaveSubsystem::StartSaveIndexScan()
+{
+        check(IsInGameThread());
 
-        CachedSaveIndex->Entries.Reset();
+        // The scan reads files straight from disk, so land any snapshots still queued first.
+        FlushPendingSaveWrites();
 
-        IFileManager::Get().IterateDirectory(*Directory, [this, &SkippedSlots, &FilesFound, &AddedEntries](const TCHAR* Path, bool bIsDirectory)
-        {
-                if (bIsDirectory)
-                {
-                        return true;
-                }
+        TSharedPtr<FSaveIndexScan> Scan = MakeShared<FSaveIndexScan>();
+        Scan->Directory = GetSaveDir();
+        Scan->EditRevision = SaveIndexEditRevision;
+        IFileManager::Get().MakeDirectory(*Scan->Directory, true);
 
-                const FString FilePath(Path);
-                if (!FilePath.EndsWith(TEXT(".sav")))
+        // Entries whose .sav still has the size and timestamp recorded at index time are carried over untouched.
+        if (CachedSaveIndex)
+        {
+                Scan->PreviousEntries.Reserve(CachedSaveIndex->Entries.Num());
+                for (const FSaveIndexEntry& Entry : CachedSaveIndex->Entries)
                 {
-                        return true;
+                        if (Entry.FileSizeBytes > 0)
+                        {
+                                Scan->PreviousEntries.Add(Entry.SlotName, Entry);
+                        }
                 }
+        }
 
-                ++FilesFound;
+        bSaveIndexRescanRequested = false;
+        InFlightSaveIndexScan = Scan;
 
-                const FString FileName = FPaths::GetCleanFilename(FilePath);
-                const FString SlotName = FPaths::GetBaseFilename(FileName);
+        auto RunScan = [Scan]()
+        {
+                const double StartSeconds = FPlatformTime::Seconds();
 
-                if (!IsSaveFileName(FileName) || SlotName.Equals(SaveIndexSlotName) || SlotName.Equals(UMO56MenuSettingsSave::StaticSlotName))
+                IFileManager::Get().IterateDirectoryStat(*Scan->Directory, [&Scan](const TCHAR* Path, const FFileStatData& StatData)
                 {
-                        if (!SlotName.IsEmpty())
+                        if (StatData.bIsDirectory)
                         {
-                                SkippedSlots.AddUnique(SlotName);
+                                return true;
                         }
-                        return true;
-                }
 
-                if (USaveGame* Loaded = UGameplayStatics::LoadGameFromSlot(SlotName, ActiveSaveUserIndex))
-                {
-                        if (UMO56SaveGame* SaveGame = Cast<UMO56SaveGame>(Loaded))
+                        const FString FilePath(Path);
+                        if (!FilePath.EndsWith(TEXT(".sav")))
+                        {
+                                return true;
+                        }
+
+                        ++Scan->FilesFound;
+
+                        const FString FileName = FPaths::GetCleanFilename(FilePath);
+                        const FString SlotName = FPaths::GetBaseFilename(FileName);
+
+                        if (!IsSaveFileName(FileName) || SlotName.Equals(SaveIndexSlotName) || SlotName.Equals(UMO56MenuSettingsSave::StaticSlotName))
                         {
-                                CacheSaveMetadata(*SaveGame);
+                                if (!SlotName.IsEmpty())
+                                {
+                                        Scan->SkippedSlots.AddUnique(SlotName);
+                                }
+                                return true;
+                        }
 
-                                if (!SaveGame->bIsGameplaySave || IsMenuOrNonGameplayMapName(SaveGame->LevelName))
+                        if (const FSaveIndexEntry* Previous = Scan->PreviousEntries.Find(SlotName))
+                        {
+                                if (Previous->FileSizeBytes == StatData.FileSize && Previous->FileModifiedUtc == StatData.ModificationTime)
                                 {
-                                        SkippedSlots.AddUnique(SlotName);
+                                        Scan->ReusedEntries.Add(*Previous);
                                         return true;
                                 }
+                        }
+
+                        FSaveIndexScan::FFile& File = Scan->FilesToRead.AddDefaulted_GetRef();
+                        File.SlotName = SlotName;
+                        File.HeaderPath = FPaths::Combine(Scan->Directory, SlotName + SaveHeaderExtension);
+                        File.FileSize = StatData.FileSize;
+                        File.ModifiedUtc = StatData.ModificationTime;
+                        return true;
+                });
+
+                // Header reads touch only the file system, so they fan out across the task graph.
+                ParallelFor(Scan->FilesToRead.Num(), [&Scan](int32 Index)
+                {
+                        FSaveIndexScan::FFile& File = Scan->FilesToRead[Index];
+                        File.bHeaderRead = ReadCurrentSaveHeaderFile(File.HeaderPath, File.ModifiedUtc, File.Header);
+                });
+
+                Scan->ScanSeconds = FPlatformTime::Seconds() - StartSeconds;
+        };
+
+        if (CVarSaveAsyncWrites.GetValueOnGameThread() == 0)
+        {
+                RunScan();
+                CompleteSaveIndexScan(Scan);
+                return;
+        }
 
-                                FSaveIndexEntry Entry;
-                                Entry.SaveId = SaveGame->SaveId;
-                                Entry.SlotName = SaveGame->SlotName;
-                                Entry.LevelName = SaveGame->LevelName;
-                                Entry.UpdatedUtc = SaveGame->UpdatedUtc;
-                                Entry.TotalPlaySeconds = SaveGame->TotalPlayTimeSeconds;
+        TWeakObjectPtr<UMO56SaveSubsystem> WeakThis(this);
+        SaveIndexScanTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, [RunScan, WeakThis, Scan]()
+        {
+                RunScan();
 
-                                CachedSaveIndex->Entries.Add(Entry);
-                                ++AddedEntries;
+                AsyncTask(ENamedThreads::GameThread, [WeakThis, Scan]()
+                {
+                        if (UMO56SaveSubsystem* This = WeakThis.Get())
+                        {
+                                This->CompleteSaveIndexScan(Scan);
                         }
-                        else if (!Loaded->IsA(UMO56MenuSettingsSave::StaticClass()))
+                });
+        });
+}
+
+void UMO56SaveSubsystem::CompleteSaveIndexScan(const TSharedPtr<FSaveIndexScan>& Scan)
+{
+        check(IsInGameThread());
+
+        // FlushSaveIndexScan may already have completed this scan before the game-thread callback ran.
+        if (!Scan || Scan != InFlightSaveIndexScan)
+        {
+                return;
+        }
+
+        InFlightSaveIndexScan.Reset();
+
+        // Saves written, deleted or re-indexed while the worker ran are not in its listing.
+        if (bSaveIndexRescanRequested || Scan->EditRevision != SaveIndexEditRevision)
+        {
+                UE_LOG(LogMO56SaveSubsystem, Verbose, TEXT("Save index changed during scan; rescanning %s"), *Scan->Directory);
+                StartSaveIndexScan();
+                return;
+        }
+
+        if (!CachedSaveIndex)
+        {
+                CachedSaveIndex = NewObject<UMO56SaveIndex>(this);
+        }
+
+        const double PublishStartSeconds = FPlatformTime::Seconds();
+
+        TArray<FString>& SkippedSlots = Scan->SkippedSlots;
+        const int32 ReusedEntries = Scan->ReusedEntries.Num();
+        TArray<FSaveIndexEntry> NewEntries = MoveTemp(Scan->ReusedEntries);
+        NewEntries.Reserve(NewEntries.Num() + Scan->FilesToRead.Num());
+
+        int32 LegacyReads = 0;
+        for (FSaveIndexScan::FFile& File : Scan->FilesToRead)
+        {
+                // Missing or stale headers fall back to one full read on the game thread, which also rewrites the header.
+                if (!File.bHeaderRead)
+                {
+                        ++LegacyReads;
+                        if (!ReadSaveHeader(File.SlotName, File.Header))
                         {
-                                SkippedSlots.AddUnique(SlotName);
-                                UE_LOG(LogMO56SaveSubsystem, Warning, TEXT("UpdateOrRebuildSaveIndex: slot %s contained unexpected class."), *SlotName);
+                                SkippedSlots.AddUnique(File.SlotName);
+                                UE_LOG(LogMO56SaveSubsystem, Warning, TEXT("UpdateOrRebuildSaveIndex: slot %s is not a readable UMO56SaveGame."), *File.SlotName);
+                                continue;
                         }
                 }
 
-                return true;
-        });
+                if (!File.Header.bIsGameplaySave || IsMenuOrNonGameplayMapName(File.Header.LevelName))
+                {
+                        SkippedSlots.AddUnique(File.SlotName);
+                        continue;
+                }
+
+                FSaveIndexEntry& Entry = NewEntries.AddDefaulted_GetRef();
+                Entry.SaveId = File.Header.SaveId;
+                Entry.SlotName = File.Header.SlotName.IsEmpty() ? File.SlotName : File.Header.SlotName;
+                Entry.LevelName = UWorld::RemovePIEPrefix(File.Header.LevelName);
+                Entry.UpdatedUtc = File.Header.UpdatedUtc;
+                Entry.TotalPlaySeconds = File.Header.TotalPlaySeconds;
+                Entry.FileSizeBytes = File.FileSize;
+                Entry.FileModifiedUtc = File.ModifiedUtc;
+        }
+
+        // Publish in one step so nothing observes a half-built index.
+        CachedSaveIndex->Entries = MoveTemp(NewEntries);
 
-        UE_LOG(LogMO56SaveSubsystem, Log, TEXT("Scanning save directory: %s"), *Directory);
-        UE_LOG(LogMO56SaveSubsystem, Log, TEXT("Found %d save files; indexed %d gameplay entries."), FilesFound, AddedEntries);
+        UE_LOG(LogMO56SaveSubsystem, Log, TEXT("Scanned save directory %s in %.2f ms (%.2f ms on the game thread): %d save files, %d unchanged, %d headers read, %d full reads; indexed %d gameplay entries."),
+                *Scan->Directory,
+                Scan->ScanSeconds * 1000.0,
+                (FPlatformTime::Seconds() - PublishStartSeconds) * 1000.0,
+                Scan->FilesFound,
+                ReusedEntries,
+                Scan->FilesToRead.Num() - LegacyReads,
+                LegacyReads,
+                CachedSaveIndex->Entries.Num());
 
         if (SkippedSlots.Num() > 0)
         {
                 UE_LOG(LogMO56SaveSubsystem, Log, TEXT("Skipped save slots: %s"), *FString::Join(SkippedSlots, TEXT(", ")));
         }
 
-        UGameplayStatics::SaveGameToSlot(CachedSaveIndex, SaveIndexSlotName, ActiveSaveUserIndex);
+        WriteSaveIndex();
 
-        ActiveSaveId = PreviousActiveSaveId;
-        ActiveSaveSlotName = PreviousActiveSlotName;
+        OnSaveIndexUpdated.Broadcast();
+}
+
+void UMO56SaveSubsystem::FlushSaveIndexScan()
+{
+        check(IsInGameThread());
+
+        while (InFlightSaveIndexScan)
+        {
+                SaveIndexScanTask.Wait();
+                CompleteSaveIndexScan(InFlightSaveIndexScan);
+        }
 }
 
 void UMO56SaveSubsystem::CacheSaveMetadata(UMO56SaveGame& SaveGame)
@@ -3906,6 +4902,8 @@ void UMO56SaveSubsystem::CacheSaveMetadata(UMO56SaveGame& SaveGame)
 
         if (CachedSaveIndex)
         {
+                ++SaveIndexEditRevision;
+
                 FSaveIndexEntry* ExistingEntry = CachedSaveIndex->Entries.FindByPredicate([&SaveGame](const FSaveIndexEntry& Entry)
                 {
                         return Entry.SaveId == SaveGame.SaveId;
@@ -4145,8 +5143,11 @@ void UMO56SaveSubsystem::RefreshCharacterSaveData(const FGuid& CharacterId)
                 return;
         }
 
+        SyncDirtyTrackingWithCurrentSave();
+
         FCharacterSaveData& CharacterData = CurrentSaveGame->CharacterStates.FindOrAdd(CharacterId);
         CharacterData.CharacterId = CharacterId;
+        FCapturedCharacterState& Captured = CapturedCharacterStates.FindOrAdd(CharacterId);
 
         if (const TWeakObjectPtr<UInventoryComponent>* InventoryPtr = CharacterToInventoryComponent.Find(CharacterId))
         {
@@ -4179,9 +5180,7 @@ void UMO56SaveSubsystem::RefreshCharacterSaveData(const FGuid& CharacterId)
                                 return;
                         }
 
-                        FInventorySaveData& InventoryData = CurrentSaveGame->InventoryStates.FindOrAdd(TargetInventoryId);
-                        Inventory->WriteToSaveData(InventoryData);
-                        EnsureInventoryOwnerMetadata(InventoryData, CharacterId);
+                        CaptureInventoryState(*Inventory, TargetInventoryId, CharacterId);
 
                         if (APawn* PawnOwner = Cast<APawn>(Inventory->GetOwner()))
                         {
@@ -4202,10 +5201,17 @@ void UMO56SaveSubsystem::RefreshCharacterSaveData(const FGuid& CharacterId)
         {
                 if (USkillSystemComponent* Skill = SkillPtr->Get())
                 {
-                        Skill->WriteToSaveData(CharacterData.SkillState);
+                        const uint32 SkillVersion = Skill->GetSaveStateVersion();
+                        if (!Captured.Skill.Matches(Skill, SkillVersion))
+                        {
+                                Skill->WriteToSaveData(CharacterData.SkillState);
+                                Captured.Skill = { Skill, SkillVersion };
+                        }
                 }
         }
 
+        Captured.Transform = CharacterData.Transform;
+
         FGuid OwningPlayerId;
         if (const TWeakObjectPtr<AMO56Character>* CharacterPtr = RegisteredCharacters.Find(CharacterId))
         {
@@ -4241,6 +5247,14 @@ void UMO56SaveSubsystem::RefreshCharacterSaveData(const FGuid& CharacterId)
         }
 
         CharacterData.OwningPlayerId = OwningPlayerId;
+
+        if (const TWeakObjectPtr<AMO56Character>* CharacterPtr = RegisteredCharacters.Find(CharacterId))
+        {
+                if (const AMO56Character* Character = CharacterPtr->Get())
+                {
+                        Captured.Controller = Character->GetController();
+                }
+        }
 }
 
 FGuid UMO56SaveSubsystem::GetStoredPersistentPlayerId(AMO56PlayerController* Controller) const
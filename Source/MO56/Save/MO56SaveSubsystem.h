@@ -9,8 +9,10 @@
 #include "Save/MO56SaveGame.h"
 #include "Save/MO56SaveTypes.h"
 #include "MO56PlayerController.h"
+#include "Containers/Ticker.h"
 #include "Delegates/Delegate.h"
 #include "TimerManager.h"
+#include "Tasks/Task.h"
 #include "MO56SaveSubsystem.generated.h"
 
 class AItemPickup;
@@ -20,9 +22,15 @@ class AMO56PlayerController;
 class AMO56Character;
 class APawn;
 class APlayerController;
+class AController;
 class UMOPersistentPawnComponent;
 class UWorld;
 class ULocalPlayer;
+class USaveGame;
+class UMO56WorldItemStore;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnMO56SaveWriteCompleted, const FString&, SlotName, bool, bSuccess);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnMO56SaveIndexUpdated);
 
 enum class ERegisterPlayerCharacterContext : uint8
 {
@@ -77,8 +85,22 @@ struct FSaveGameSummary
  * 3. Ensure playable pawns call RegisterInventoryComponent/RegisterSkillComponent in BeginPlay for persistence.
  * 4. Hook NotifyPlayerControllerReady/RegisterPlayerCharacter from PlayerController/Character Blueprints after possession.
  * 5. Extend RegisterWorldPickup/TrackedPickups when introducing new persistent actors (structures, quest items, etc.).
+ * 6. Call RequestAutosave after gameplay changes that should persist (High for crafting results, possession, etc.);
+ *    the scheduler coalesces bursts and honours the MO56.Save.Autosave.* policy cvars. Inspect it with MO56.Save.AutosaveStatus.
+ * 7. SaveGame only snapshots state; the file is written on a worker thread. Bind OnSaveWriteCompleted for
+ *    "Game saved" feedback, and call FlushPendingSaveWrites before anything that reads the .sav files directly.
+ * 8. ListSaves returns the cached index at once; a rebuild it requests scans the save folder on a worker thread.
+ *    Bind OnSaveIndexUpdated to repopulate save lists when the scan lands, or call FlushSaveIndexScan to wait for it.
  */
 
+/** How urgently a change should reach disk. High skips the coalescing window and the per-minute write budget. */
+UENUM(BlueprintType)
+enum class EMO56AutosavePriority : uint8
+{
+        Normal,
+        High
+};
+
 UENUM(BlueprintType)
 enum class EMO56InventoryOwner : uint8
 {
@@ -105,8 +127,12 @@ public:
         UFUNCTION(BlueprintCallable, Category = "Save")
         bool DoesSaveExist(const FGuid& SaveId) const;
 
+        /**
+         * Reads only the small <Slot>.hdr summary of a save into OutHeader; the full UMO56SaveGame is loaded by LoadSave
+         * alone. Returns false when the save has no readable header.
+         */
         UFUNCTION(BlueprintCallable, Category = "Save")
-        UMO56SaveGame* PeekSaveHeader(const FGuid& SaveId);
+        bool PeekSaveHeader(const FGuid& SaveId, FMO56SaveHeader& OutHeader);
 
         UFUNCTION(BlueprintCallable, Category = "Save")
         void StartNewGame(const FString& LevelName = TEXT("M_TestLevel"));
@@ -193,6 +219,48 @@ public:
         UFUNCTION(BlueprintCallable, Category = "Save")
         TArray<FSaveGameSummary> GetAvailableSaveSummaries() const;
 
+        /** Marks the world as having unsaved changes and schedules an autosave according to the autosave policy. */
+        UFUNCTION(BlueprintCallable, Category = "Save")
+        void RequestAutosave(EMO56AutosavePriority Priority = EMO56AutosavePriority::Normal);
+
+        /** One-line summary of the autosave scheduler for the MO56.Save.AutosaveStatus console command. */
+        FString DescribeAutosaveState() const;
+
+        /** Blocks until every queued save snapshot has been written to disk. */
+        UFUNCTION(BlueprintCallable, Category = "Save")
+        void FlushPendingSaveWrites();
+
+        /** Blocks until a running save index scan has finished and its entries have been published. */
+        UFUNCTION(BlueprintCallable, Category = "Save")
+        void FlushSaveIndexScan();
+
+        /** True while save snapshots are queued or being written. */
+        UFUNCTION(BlueprintPure, Category = "Save")
+        bool HasPendingSaveWrites() const;
+
+        /** Entries refreshed versus skipped as unchanged by the most recent SaveGame. */
+        struct FSaveRefreshStats
+        {
+                int32 InventoriesWritten = 0;
+                int32 InventoriesSkipped = 0;
+                int32 CharactersWritten = 0;
+                int32 CharactersSkipped = 0;
+                int32 PickupsWritten = 0;
+                int32 PickupsSkipped = 0;
+
+                int32 GetSkippedCount() const { return InventoriesSkipped + CharactersSkipped + PickupsSkipped; }
+        };
+
+        const FSaveRefreshStats& GetLastSaveRefreshStats() const { return LastSaveRefreshStats; }
+
+        /** Broadcast on the game thread once a queued slot write has been committed to disk (or failed). */
+        UPROPERTY(BlueprintAssignable, Category = "Save")
+        FOnMO56SaveWriteCompleted OnSaveWriteCompleted;
+
+        /** Broadcast on the game thread after a save directory scan has replaced the cached index entries. */
+        UPROPERTY(BlueprintAssignable, Category = "Save")
+        FOnMO56SaveIndexUpdated OnSaveIndexUpdated;
+
 private:
         static constexpr const TCHAR* SaveSlotName = TEXT("MO56_Default");
         static constexpr int32 SaveUserIndex = 0;
@@ -258,9 +326,80 @@ private:
 
         bool bIsApplyingSave = false;
         bool bAutosavePending = false;
-        FTimerHandle AutosaveTimerHandle;
+        FTSTicker::FDelegateHandle AutosaveTickerHandle;
         FTimerHandle PostLoadValidationTimerHandle;
-        float AutosaveDelaySeconds = 0.2f;
+
+        /**
+         * Autosave scheduler state. Times are FPlatformTime::Seconds and the due save fires from the core ticker rather
+         * than a world timer, so pausing or dilating the world does not stretch the data-loss window.
+         */
+        EMO56AutosavePriority PendingAutosavePriority = EMO56AutosavePriority::Normal;
+        double FirstUnsavedChangeSeconds = 0.0;
+        double LastUnsavedChangeSeconds = 0.0;
+        double AutosaveDueSeconds = 0.0;
+        double LastSaveWriteSeconds = 0.0;
+        bool bHasWrittenSave = false;
+
+        /** Times of the writes inside the trailing one-minute budget window, oldest first. */
+        TArray<double> RecentSaveWriteSeconds;
+
+        /** Snapshots waiting for the writer, keyed by slot. A newer snapshot of a slot replaces the queued one. */
+        UPROPERTY(Transient)
+        TMap<FString, TObjectPtr<USaveGame>> QueuedSaveWrites;
+
+        /** Snapshots owned by the running write task; referenced here so GC keeps them alive until it completes. */
+        UPROPERTY(Transient)
+        TArray<TObjectPtr<USaveGame>> InFlightSaveSnapshots;
+
+        struct FSaveWriteBatch;
+        TSharedPtr<FSaveWriteBatch> InFlightSaveWriteBatch;
+        UE::Tasks::FTask SaveWriteTask;
+
+        struct FSaveIndexScan;
+        TSharedPtr<FSaveIndexScan> InFlightSaveIndexScan;
+        UE::Tasks::FTask SaveIndexScanTask;
+
+        /** Set when a rebuild is requested while a scan is running; the running scan's result is then discarded. */
+        bool bSaveIndexRescanRequested = false;
+
+        /** Bumped by every game-thread edit of the index entries, so a scan launched before the edit is redone. */
+        uint32 SaveIndexEditRevision = 0;
+
+        /**
+         * Change version of a live object as last copied into CurrentSaveGame, together with the object it was read
+         * from. Versions are per object and restart for every new one, so a different object that took over the same
+         * persistent id never matches, whatever version it has reached.
+         */
+        struct FCapturedVersion
+        {
+                TWeakObjectPtr<const UObject> Source;
+                uint32 Version = 0;
+
+                bool Matches(const UObject* Object, uint32 InVersion) const { return Object && Source.Get() == Object && Version == InVersion; }
+        };
+
+        /** Source state last copied into a CharacterStates entry. */
+        struct FCapturedCharacterState
+        {
+                FTransform Transform = FTransform::Identity;
+                FCapturedVersion Skill;
+                TWeakObjectPtr<AController> Controller;
+        };
+
+        /**
+         * Captured versions of the live objects, keyed by persistent id. Every write serializes the whole
+         * CurrentSaveGame, so an entry whose source object and version still match is already on its way to disk and
+         * the refresh skips it. Cleared whenever CurrentSaveGame is replaced.
+         */
+        TWeakObjectPtr<UMO56SaveGame> DirtyTrackingSave;
+        TMap<FGuid, FCapturedVersion> CapturedInventoryVersions;
+        TMap<FGuid, FCapturedCharacterState> CapturedCharacterStates;
+        TMap<FGuid, FCapturedVersion> CapturedPickupVersions;
+        TWeakObjectPtr<const UMO56WorldItemStore> CapturedItemStore;
+        uint32 CapturedItemStoreRevision = 0;
+
+        FSaveRefreshStats SaveRefreshStats;
+        FSaveRefreshStats LastSaveRefreshStats;
 
         /** Map names that allow gameplay autosaves. */
         UPROPERTY(EditAnywhere, Category = "Save|Maps")
@@ -298,6 +437,9 @@ private:
         void RefreshInventorySaveData();
         void RefreshTrackedPickups();
 
+        /** Writes records held by the world item store into the level's DroppedItems. */
+        void RefreshVirtualizedPickups();
+
         FName ResolveLevelName(const AActor& Actor) const;
         FName ResolveLevelName(const UWorld& World) const;
 
@@ -321,18 +463,36 @@ private:
         void SyncPlayerSaveData(const FGuid& PlayerId);
         void ApplyCharacterStateFromSave(const FGuid& CharacterId);
         void RefreshCharacterSaveData(const FGuid& CharacterId);
-        void HandleAutosaveTimerElapsed();
+        void SyncDirtyTrackingWithCurrentSave();
+        bool CaptureInventoryState(UInventoryComponent& Inventory, const FGuid& InventoryId, const FGuid& OwnerId);
+        bool IsCharacterSaveDirty(const FGuid& CharacterId) const;
+        bool HandleAutosaveTick(float DeltaTime);
+        void ScheduleAutosave();
+        void CancelAutosaveTicker();
+        double ComputeAutosaveDueSeconds(double NowSeconds) const;
+        double GetSaveBudgetAvailableSeconds(double NowSeconds) const;
+        void NoteSaveWritten();
         void SchedulePostPossessionValidation(UWorld& World);
         void QueuePersistentPawnRetry(APlayerController* PlayerController);
 
         FString MakeSlotName(const FGuid& SaveId) const;
         FString GetSaveDir() const;
-        bool IsSaveFileName(const FString& Name) const;
+        FString GetSaveHeaderPath(const FString& SlotName) const;
+        bool ReadSaveHeader(const FString& SlotName, FMO56SaveHeader& OutHeader);
+        static bool IsSaveFileName(const FString& Name);
         bool WriteSave(const UMO56SaveGame* Data);
+        void WriteSaveIndex();
+        void QueueSaveWrite(const FString& SlotName, const USaveGame& Source);
+        void StartNextSaveWriteBatch();
+        void CompleteSaveWriteBatch(const TSharedPtr<FSaveWriteBatch>& Batch);
+        bool IsSaveWritePending(const FString& SlotName) const;
+        void RecoverInterruptedSaveWrites();
 
         bool IsRestoringWorld() const { return bIsRestoringWorld; }
         UMO56SaveGame* ReadSave(const FGuid& SaveId, bool bUpdateMetadata = true);
         void UpdateOrRebuildSaveIndex(bool bForceRebuild = false);
+        void StartSaveIndexScan();
+        void CompleteSaveIndexScan(const TSharedPtr<FSaveIndexScan>& Scan);
         void CacheSaveMetadata(UMO56SaveGame& SaveGame);
         bool IsMenuOrNonGameplayMap(const UWorld* World) const;
         bool CanAutosaveInWorld(const UWorld& World) const;
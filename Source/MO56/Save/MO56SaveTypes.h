@@ -62,10 +62,60 @@ struct FSaveIndexEntry
 
         UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Save|Index")
         FString ScreenshotPath;
+
+        /** Size of the .sav when this entry was indexed; with FileModifiedUtc lets a rebuild skip unchanged files. */
+        UPROPERTY(VisibleAnywhere, Category = "Save|Index")
+        int64 FileSizeBytes = 0;
+
+        UPROPERTY(VisibleAnywhere, Category = "Save|Index")
+        FDateTime FileModifiedUtc;
 };
 
 inline constexpr int32 MO56_SAVE_VERSION = 1;
 
+/**
+ * Fixed-layout summary written next to each gameplay save as <Slot>.hdr, so menus and the index scan can describe
+ * a save without deserializing its UMO56SaveGame. Plain data with no UObjects, safe to read on worker threads.
+ */
+USTRUCT(BlueprintType)
+struct FMO56SaveHeader
+{
+        GENERATED_BODY()
+
+        /** 'M56H'; anything else is not a header. */
+        static constexpr uint32 FileMagic = 0x4D353648;
+
+        /** Bump when the layout below changes; headers with another layout read as missing and are regenerated. */
+        static constexpr uint32 FileVersion = 1;
+
+        UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Save|Header")
+        int32 SaveVersion = MO56_SAVE_VERSION;
+
+        UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Save|Header")
+        FGuid SaveId;
+
+        UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Save|Header")
+        FString SlotName;
+
+        UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Save|Header")
+        FString LevelName;
+
+        UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Save|Header")
+        FDateTime CreatedUtc;
+
+        UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Save|Header")
+        FDateTime UpdatedUtc;
+
+        UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Save|Header")
+        float TotalPlaySeconds = 0.f;
+
+        UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Save|Header")
+        int32 InventoryCount = 0;
+
+        UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Save|Header")
+        bool bIsGameplaySave = true;
+};
+
 USTRUCT()
 struct FPawnSaveData
 {
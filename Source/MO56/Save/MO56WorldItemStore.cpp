@@ -0,0 +1,361 @@
+// Implementation: Server-only proxy management for virtualized world items. Records enter the store
+// when their pickup is far from every player (or straight from a save) and leave it again when a
+// pooled proxy actor is placed for them.
+#include "Save/MO56WorldItemStore.h"
+
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "ItemData.h"
+#include "ItemPickup.h"
+#include "ItemPickupPool.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogMO56WorldItems, Log, All);
+
+namespace
+{
+        static TAutoConsoleVariable<int32> CVarWorldItemsVirtualize(
+                TEXT("MO56.WorldItems.Virtualize"),
+                0,
+                TEXT("Keep dropped pickups far from every player as data records and spawn proxy actors only near players."),
+                ECVF_Default);
+
+        static TAutoConsoleVariable<float> CVarWorldItemsProxyRadius(
+                TEXT("MO56.WorldItems.ProxyRadius"),
+                6000.f,
+                TEXT("Radius (cm) around players inside which virtualized world items get proxy actors."),
+                ECVF_Default);
+
+        static TAutoConsoleVariable<int32> CVarWorldItemsMaxSpawnsPerUpdate(
+                TEXT("MO56.WorldItems.MaxSpawnsPerUpdate"),
+                64,
+                TEXT("Upper bound on proxy actors materialized per store update."),
+                ECVF_Default);
+
+        /** Proxies are only virtualized again once every player is this much farther than ProxyRadius. */
+        constexpr float DespawnRadiusScale = 1.25f;
+        constexpr float UpdateIntervalSeconds = 0.5f;
+}
+
+bool UMO56WorldItemStore::IsVirtualizationEnabled()
+{
+        return CVarWorldItemsVirtualize.GetValueOnGameThread() != 0;
+}
+
+bool UMO56WorldItemStore::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+        return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UMO56WorldItemStore::OnWorldBeginPlay(UWorld& InWorld)
+{
+        Super::OnWorldBeginPlay(InWorld);
+
+        if (InWorld.GetNetMode() == NM_Client)
+        {
+                return;
+        }
+
+        InWorld.GetTimerManager().SetTimer(UpdateTimerHandle, this, &UMO56WorldItemStore::UpdateProxies, UpdateIntervalSeconds, true);
+}
+
+void UMO56WorldItemStore::Deinitialize()
+{
+        if (UWorld* World = GetWorld())
+        {
+                World->GetTimerManager().ClearTimer(UpdateTimerHandle);
+        }
+
+        Reset();
+
+        Super::Deinitialize();
+}
+
+void UMO56WorldItemStore::AddRecord(const FWorldItemSaveData& Record)
+{
+        if (!Record.PickupId.IsValid())
+        {
+                return;
+        }
+
+        if (const FWorldItemSaveData* Existing = Records.Find(Record.PickupId))
+        {
+                RemoveFromGrid(Record.PickupId, Existing->Transform.GetLocation());
+        }
+
+        Records.Add(Record.PickupId, Record);
+        AddToGrid(Record.PickupId, Record.Transform.GetLocation());
+        ++RecordsRevision;
+}
+
+void UMO56WorldItemStore::Reset()
+{
+        Records.Reset();
+        RecordCells.Reset();
+        RecordAssetHandles.Reset();
+        ++RecordsRevision;
+}
+
+FIntVector UMO56WorldItemStore::ToCell(const FVector& Location) const
+{
+        const float CellSize = FMath::Max(1.f, GridCellSize);
+        return FIntVector(
+                FMath::FloorToInt32(Location.X / CellSize),
+                FMath::FloorToInt32(Location.Y / CellSize),
+                FMath::FloorToInt32(Location.Z / CellSize));
+}
+
+void UMO56WorldItemStore::RebuildGrid(float CellSize)
+{
+        GridCellSize = CellSize;
+        RecordCells.Reset();
+
+        for (const TPair<FGuid, FWorldItemSaveData>& Pair : Records)
+        {
+                AddToGrid(Pair.Key, Pair.Value.Transform.GetLocation());
+        }
+}
+
+void UMO56WorldItemStore::AddToGrid(const FGuid& PickupId, const FVector& Location)
+{
+        RecordCells.FindOrAdd(ToCell(Location)).Add(PickupId);
+}
+
+void UMO56WorldItemStore::RemoveFromGrid(const FGuid& PickupId, const FVector& Location)
+{
+        const FIntVector Cell = ToCell(Location);
+        if (TArray<FGuid>* CellIds = RecordCells.Find(Cell))
+        {
+                CellIds->RemoveSwap(PickupId);
+                if (CellIds->Num() == 0)
+                {
+                        RecordCells.Remove(Cell);
+                }
+        }
+}
+
+void UMO56WorldItemStore::UpdateProxies()
+{
+        UWorld* World = GetWorld();
+        if (!World || World->GetNetMode() == NM_Client || !IsVirtualizationEnabled())
+        {
+                return;
+        }
+
+        const float ProxyRadius = FMath::Max(100.f, CVarWorldItemsProxyRadius.GetValueOnGameThread());
+        if (!FMath::IsNearlyEqual(ProxyRadius, GridCellSize))
+        {
+                RebuildGrid(ProxyRadius);
+        }
+
+        TArray<FVector, TInlineAllocator<8>> ViewerLocations;
+        for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+        {
+                if (const APlayerController* PlayerController = It->Get())
+                {
+                        ViewerLocations.Add(PlayerController->GetFocalLocation());
+                }
+        }
+
+        if (ViewerLocations.Num() == 0)
+        {
+                // Nobody to measure against (e.g. while loading); leave actors and records as they are.
+                return;
+        }
+
+        const float DespawnRadiusSquared = FMath::Square(ProxyRadius * DespawnRadiusScale);
+        const float ProxyRadiusSquared = FMath::Square(ProxyRadius);
+
+        TArray<AItemPickup*> ToVirtualize;
+        for (TActorIterator<AItemPickup> It(World); It; ++It)
+        {
+                AItemPickup* Pickup = *It;
+                if (!Pickup || Pickup->IsPooled() || Pickup->IsSettling() || !Pickup->WasSpawnedFromInventory()
+                        || !Pickup->GetItem() || !Pickup->GetPersistentId().IsValid())
+                {
+                        continue;
+                }
+
+                const FVector Location = Pickup->GetActorLocation();
+                const bool bNearViewer = ViewerLocations.ContainsByPredicate([&](const FVector& Viewer)
+                {
+                        return FVector::DistSquared(Viewer, Location) <= DespawnRadiusSquared;
+                });
+
+                if (!bNearViewer)
+                {
+                        ToVirtualize.Add(Pickup);
+                }
+        }
+
+        for (AItemPickup* Pickup : ToVirtualize)
+        {
+                VirtualizePickup(*Pickup);
+        }
+
+        TArray<FGuid> ToMaterialize;
+        const int32 MaxSpawns = FMath::Max(1, CVarWorldItemsMaxSpawnsPerUpdate.GetValueOnGameThread());
+        for (const FVector& Viewer : ViewerLocations)
+        {
+                const FIntVector ViewerCell = ToCell(Viewer);
+                for (int32 X = -1; X <= 1; ++X)
+                {
+                        for (int32 Y = -1; Y <= 1; ++Y)
+                        {
+                                for (int32 Z = -1; Z <= 1; ++Z)
+                                {
+                                        const TArray<FGuid>* CellIds = RecordCells.Find(ViewerCell + FIntVector(X, Y, Z));
+                                        if (!CellIds)
+                                        {
+                                                continue;
+                                        }
+
+                                        for (const FGuid& PickupId : *CellIds)
+                                        {
+                                                const FWorldItemSaveData& Record = Records.FindChecked(PickupId);
+                                                if (FVector::DistSquared(Viewer, Record.Transform.GetLocation()) <= ProxyRadiusSquared)
+                                                {
+                                                        ToMaterialize.AddUnique(PickupId);
+                                                }
+                                        }
+                                }
+                        }
+                }
+        }
+
+        int32 Spawned = 0;
+        for (const FGuid& PickupId : ToMaterialize)
+        {
+                if (Spawned >= MaxSpawns)
+                {
+                        break;
+                }
+
+                if (MaterializeRecord(PickupId))
+                {
+                        ++Spawned;
+                }
+        }
+
+        if (ToVirtualize.Num() > 0 || Spawned > 0)
+        {
+                UE_LOG(LogMO56WorldItems, Verbose, TEXT("UpdateProxies: Virtualized=%d Materialized=%d Records=%d"), ToVirtualize.Num(), Spawned, Records.Num());
+        }
+}
+
+void UMO56WorldItemStore::VirtualizePickup(AItemPickup& Pickup)
+{
+        FWorldItemSaveData Record;
+        Record.PickupId = Pickup.GetPersistentId();
+        Record.ItemPath = FSoftObjectPath(Pickup.GetItem());
+        Record.PickupClass = Pickup.GetClass();
+        Record.Transform = Pickup.GetActorTransform();
+        Record.Quantity = Pickup.GetQuantity();
+        Record.bSpawnedFromInventory = true;
+
+        // Record first: the save subsystem checks the store when the actor reports itself removed.
+        AddRecord(Record);
+        UItemPickupPoolSubsystem::ReleaseOrDestroy(&Pickup);
+}
+
+UObject* UMO56WorldItemStore::ResolveRecordAsset(const FSoftObjectPath& Path, bool& bOutFailed)
+{
+        bOutFailed = false;
+        if (Path.IsNull())
+        {
+                return nullptr;
+        }
+
+        if (UObject* Resident = Path.ResolveObject())
+        {
+                return Resident;
+        }
+
+        TSharedPtr<FStreamableHandle>& Handle = RecordAssetHandles.FindOrAdd(Path);
+        if (!Handle.IsValid())
+        {
+                Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(Path, FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority);
+                if (!Handle.IsValid())
+                {
+                        // The streamable manager rejected the path outright.
+                        bOutFailed = true;
+                }
+
+                return nullptr;
+        }
+
+        bOutFailed = Handle->HasLoadCompleted() || Handle->WasCanceled();
+        return nullptr;
+}
+
+bool UMO56WorldItemStore::MaterializeRecord(const FGuid& PickupId)
+{
+        UWorld* World = GetWorld();
+        const FWorldItemSaveData* RecordPtr = Records.Find(PickupId);
+        if (!World || !RecordPtr)
+        {
+                return false;
+        }
+
+        // Never block the update on a load: records whose assets are still streaming are retried next update.
+        bool bItemFailed = false;
+        UItemData* ItemData = Cast<UItemData>(ResolveRecordAsset(RecordPtr->ItemPath, bItemFailed));
+        if (!ItemData)
+        {
+                if (bItemFailed || RecordPtr->ItemPath.IsNull())
+                {
+                        UE_LOG(LogMO56WorldItems, Warning, TEXT("MaterializeRecord: dropping %s, item %s failed to load"), *PickupId.ToString(), *RecordPtr->ItemPath.ToString());
+                        RemoveFromGrid(PickupId, RecordPtr->Transform.GetLocation());
+                        Records.Remove(PickupId);
+                }
+                return false;
+        }
+
+        bool bClassFailed = false;
+        UClass* PickupClass = Cast<UClass>(ResolveRecordAsset(RecordPtr->PickupClass.ToSoftObjectPath(), bClassFailed));
+        if (!PickupClass)
+        {
+                if (!bClassFailed && !RecordPtr->PickupClass.IsNull())
+                {
+                        return false;
+                }
+
+                PickupClass = AItemPickup::StaticClass();
+        }
+
+        // Leave the store before the actor exists so save tracking treats it as a live pickup again.
+        const FWorldItemSaveData Record = *RecordPtr;
+        RemoveFromGrid(PickupId, Record.Transform.GetLocation());
+        Records.Remove(PickupId);
+
+        // The record's id is assigned before activation is announced, so save tracking registers the proxy under it.
+        AItemPickup* Pickup = nullptr;
+        if (UItemPickupPoolSubsystem* Pool = World->GetSubsystem<UItemPickupPoolSubsystem>())
+        {
+                Pickup = Pool->AcquirePickupWithId(PickupClass, Record.Transform, Record.PickupId);
+        }
+        else
+        {
+                Pickup = World->SpawnActorDeferred<AItemPickup>(PickupClass, Record.Transform, nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+                if (Pickup)
+                {
+                        Pickup->SetPersistentId(Record.PickupId);
+                        Pickup->FinishSpawning(Record.Transform);
+                }
+        }
+
+        if (!Pickup)
+        {
+                AddRecord(Record);
+                return false;
+        }
+
+        Pickup->SetItem(ItemData);
+        Pickup->SetQuantity(Record.Quantity);
+        Pickup->SetWasSpawnedFromInventory(true);
+        Pickup->RestoreSettled(Record.Transform);
+        return true;
+}
@@ -0,0 +1,81 @@
+// Implementation: World subsystem that keeps settled, inventory-dropped pickups far from every
+// player as plain FWorldItemSaveData records and only materializes AItemPickup proxies inside
+// MO56.WorldItems.ProxyRadius of a player. Enable with MO56.WorldItems.Virtualize 1; the save
+// subsystem reads the records directly when refreshing level state.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Save/MO56SaveGame.h"
+#include "TimerManager.h"
+#include "MO56WorldItemStore.generated.h"
+
+class AItemPickup;
+struct FStreamableHandle;
+
+/**
+ * Data-only store for dropped world items.
+ *
+ * Editor Implementation Guide:
+ * 1. No setup is required in levels; the subsystem exists in every game/PIE world and stays idle until enabled.
+ * 2. Turn it on with MO56.WorldItems.Virtualize 1 (e.g. in DefaultEngine.ini [ConsoleVariables]) on dedicated servers with many drops.
+ * 3. Tune MO56.WorldItems.ProxyRadius to slightly exceed the pickup net cull distance so proxies exist before clients see them.
+ * 4. Only pickups dropped from inventories are virtualized; pickups placed in the level stay as actors.
+ */
+UCLASS()
+class MO56_API UMO56WorldItemStore : public UWorldSubsystem
+{
+        GENERATED_BODY()
+
+public:
+        virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+        virtual void Deinitialize() override;
+
+        static bool IsVirtualizationEnabled();
+
+        /** Stores Record without spawning an actor; a proxy appears once a player comes within range. */
+        void AddRecord(const FWorldItemSaveData& Record);
+
+        /** Drops every record, e.g. before the world state is re-applied from a save. */
+        void Reset();
+
+        bool IsVirtualized(const FGuid& PickupId) const { return Records.Contains(PickupId); }
+
+        const TMap<FGuid, FWorldItemSaveData>& GetRecords() const { return Records; }
+
+        /** Increments whenever a record is added or replaced. */
+        uint32 GetRecordsRevision() const { return RecordsRevision; }
+
+protected:
+        virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+        void UpdateProxies();
+        void VirtualizePickup(AItemPickup& Pickup);
+        /** Places a proxy for the record if its item and pickup class are resident; otherwise requests them and waits. */
+        bool MaterializeRecord(const FGuid& PickupId);
+
+        /**
+         * Returns the object at Path if it is loaded. Otherwise starts an async load (once per path) and returns null;
+         * bOutFailed is set once a finished load produced nothing.
+         */
+        UObject* ResolveRecordAsset(const FSoftObjectPath& Path, bool& bOutFailed);
+
+        void RebuildGrid(float CellSize);
+        void AddToGrid(const FGuid& PickupId, const FVector& Location);
+        void RemoveFromGrid(const FGuid& PickupId, const FVector& Location);
+        FIntVector ToCell(const FVector& Location) const;
+
+        /** Virtualized items keyed by pickup id. */
+        TMap<FGuid, FWorldItemSaveData> Records;
+        uint32 RecordsRevision = 0;
+
+        /** Uniform grid over Records with ProxyRadius-sized cells, so a viewer only visits the 27 cells around it. */
+        TMap<FIntVector, TArray<FGuid>> RecordCells;
+        float GridCellSize = 0.f;
+
+        /** Async loads for record assets, kept alive so materialized proxies never wait on the same asset twice. */
+        TMap<FSoftObjectPath, TSharedPtr<FStreamableHandle>> RecordAssetHandles;
+
+        FTimerHandle UpdateTimerHandle;
+};
@@ -464,6 +464,7 @@ void USkillSystemComponent::HandleInspectionCompleted(FGuid InspectionId)
 
 void USkillSystemComponent::BroadcastSkillUpdate()
 {
+        ++SaveStateVersion;
         OnSkillStateChanged.Broadcast();
         NotifySaveSubsystemOfUpdate();
 }
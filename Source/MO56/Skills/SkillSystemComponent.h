@@ -197,6 +197,9 @@ public:
         /** Restores the component state from save data. */
         void ReadFromSaveData(const FSkillSystemSaveData& InData);
 
+        /** Increments with every skill or knowledge change; lets the save subsystem skip unchanged components. */
+        uint32 GetSaveStateVersion() const { return SaveStateVersion; }
+
 protected:
         virtual void BeginPlay() override;
         virtual void TickComponent(float DeltaTime, ELevelTick TickType,
@@ -221,6 +224,8 @@ private:
         /** Map tracking which knowledge rewards have been claimed per source object. */
         mutable TMap<TWeakObjectPtr<const UObject>, TSet<FName>> ClaimedKnowledgeBySource;
 
+        uint32 SaveStateVersion = 0;
+
         void InitializeDefaults();
 
         void HandleInspectionCompleted(FGuid InspectionId);
@@ -4,6 +4,7 @@
 #include "Engine/Texture2D.h"
 #include "ItemData.h"
 #include "InventoryComponent.h"
+#include "UI/MO56ItemIconSubsystem.h"
 
 void UInventorySlotDragVisual::SetDraggedStack(const FItemStack& Stack)
 {
@@ -14,14 +15,41 @@ void UInventorySlotDragVisual::SetDraggedStack(const FItemStack& Stack)
 
 	if (Stack.Item)
 	{
-		if (UTexture2D* IconTexture = Stack.Item->Icon.LoadSynchronous())
+		// The source slot already requested this icon, so it is resident unless it failed to load.
+		UMO56ItemIconSubsystem* IconCache = UMO56ItemIconSubsystem::Get(this);
+		if (UTexture2D* IconTexture = IconCache ? IconCache->FindIcon(Stack.Item) : Stack.Item->Icon.Get())
 		{
-			ItemIcon->SetBrushFromTexture(IconTexture);
+			FSlateBrush Brush = ItemIcon->GetBrush();
+			if (IconCache)
+			{
+				IconCache->ApplyIconToBrush(IconTexture, Brush, this);
+			}
+			else
+			{
+				Brush.SetResourceObject(IconTexture);
+			}
+			ItemIcon->SetBrush(Brush);
 			ItemIcon->SetVisibility(ESlateVisibility::Visible);
 			return;
 		}
 	}
 
+	if (UMO56ItemIconSubsystem* IconCache = UMO56ItemIconSubsystem::Get(this))
+	{
+		IconCache->ReleaseIconBrush(this);
+	}
+
 	ItemIcon->SetBrushFromTexture(nullptr);
 	ItemIcon->SetVisibility(ESlateVisibility::Hidden);
 }
+
+void UInventorySlotDragVisual::NativeDestruct()
+{
+	// The drag is over; let the icon cache reuse the atlas cell this preview was sampling.
+	if (UMO56ItemIconSubsystem* IconCache = UMO56ItemIconSubsystem::Get(this))
+	{
+		IconCache->ReleaseIconBrush(this);
+	}
+
+	Super::NativeDestruct();
+}
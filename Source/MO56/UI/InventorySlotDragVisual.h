@@ -26,6 +26,8 @@ public:
 	void SetDraggedStack(const FItemStack& Stack);
 
 protected:
+	virtual void NativeDestruct() override;
+
 	UPROPERTY(BlueprintReadOnly, meta = (BindWidgetOptional))
 	TObjectPtr<UImage> ItemIcon;
 };
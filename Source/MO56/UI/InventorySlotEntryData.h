@@ -0,0 +1,25 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "InventorySlotEntryData.generated.h"
+
+class UInventoryComponent;
+class USkillSystemComponent;
+
+/**
+ * List item handed to a virtualized inventory tile view; one per slot, pooled by UInventoryWidget.
+ * Entry widgets (UInventorySlotWidget) read the slot contents from the inventory when the item is assigned.
+ */
+UCLASS(Transient)
+class MO56_API UInventorySlotEntryData : public UObject
+{
+        GENERATED_BODY()
+
+public:
+        TWeakObjectPtr<UInventoryComponent> Inventory;
+
+        TWeakObjectPtr<USkillSystemComponent> SkillSystem;
+
+        int32 SlotIndex = INDEX_NONE;
+};
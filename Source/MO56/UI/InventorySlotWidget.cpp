@@ -2,7 +2,9 @@
 
 #include "UI/InventorySlotDragOperation.h"
 #include "UI/InventorySlotDragVisual.h"
+#include "UI/InventorySlotEntryData.h"
 #include "UI/InventorySlotMenuWidget.h"
+#include "UI/MO56ItemIconSubsystem.h"
 
 #include "Blueprint/WidgetBlueprintLibrary.h"
 #include "Blueprint/WidgetLayoutLibrary.h"
@@ -125,6 +127,9 @@ UInventorySlotWidget::UInventorySlotWidget(const FObjectInitializer& ObjectIniti
 {
 	ContextMenuClass = UInventorySlotMenuWidget::StaticClass();
 	DragVisualClass = UInventorySlotDragVisual::StaticClass();
+
+	// Faint square until the real icon streams in.
+	PlaceholderIconBrush.TintColor = FSlateColor(FLinearColor(1.f, 1.f, 1.f, 0.15f));
 }
 
 void UInventorySlotWidget::SetItemStack(const FItemStack& Stack)
@@ -133,23 +138,48 @@ void UInventorySlotWidget::SetItemStack(const FItemStack& Stack)
 
         if (ItemIcon)
         {
-                if (Stack.Item)
+                const uint32 RequestSerial = ++IconRequestSerial;
+
+                if (!Stack.Item || Stack.Item->Icon.IsNull())
                 {
-                        if (UTexture2D* IconTexture = Stack.Item->Icon.LoadSynchronous())
+                        HideIcon();
+                }
+                else if (UMO56ItemIconSubsystem* IconCache = UMO56ItemIconSubsystem::Get(this))
+                {
+                        UTexture2D* IconTexture = IconCache->RequestIcon(Stack.Item, FOnItemIconLoaded::CreateWeakLambda(this, [this, RequestSerial](UTexture2D* LoadedIcon)
                         {
-                                ItemIcon->SetBrushFromTexture(IconTexture);
-                                ItemIcon->SetVisibility(ESlateVisibility::Visible);
+                                if (RequestSerial != IconRequestSerial)
+                                {
+                                        return;
+                                }
+
+                                if (LoadedIcon)
+                                {
+                                        ShowIconTexture(LoadedIcon);
+                                }
+                                else
+                                {
+                                        HideIcon();
+                                }
+                        }));
+
+                        if (IconTexture)
+                        {
+                                ShowIconTexture(IconTexture);
                         }
                         else
                         {
-                                ItemIcon->SetBrushFromTexture(nullptr);
-                                ItemIcon->SetVisibility(ESlateVisibility::Hidden);
+                                ShowIconPlaceholder();
                         }
                 }
+                else if (UTexture2D* LoadedIcon = Stack.Item->Icon.Get())
+                {
+                        // Designer previews have no game instance; only show icons that are already in memory.
+                        ShowIconTexture(LoadedIcon);
+                }
                 else
                 {
-                        ItemIcon->SetBrushFromTexture(nullptr);
-                        ItemIcon->SetVisibility(ESlateVisibility::Hidden);
+                        ShowIconPlaceholder();
                 }
         }
 
@@ -192,6 +222,52 @@ void UInventorySlotWidget::SetItemStack(const FItemStack& Stack)
         }
 }
 
+void UInventorySlotWidget::ShowIconTexture(UTexture2D* IconTexture)
+{
+        DisplayedIconTexture = IconTexture;
+
+        FSlateBrush Brush = IconBrushTemplate;
+        if (UMO56ItemIconSubsystem* IconCache = UMO56ItemIconSubsystem::Get(this))
+        {
+                IconCache->ApplyIconToBrush(IconTexture, Brush, this);
+        }
+        else
+        {
+                Brush.SetResourceObject(IconTexture);
+        }
+
+        ItemIcon->SetBrush(Brush);
+        ItemIcon->SetVisibility(ESlateVisibility::Visible);
+}
+
+void UInventorySlotWidget::ShowIconPlaceholder()
+{
+        DisplayedIconTexture.Reset();
+        if (UMO56ItemIconSubsystem* IconCache = UMO56ItemIconSubsystem::Get(this))
+        {
+                IconCache->ReleaseIconBrush(this);
+        }
+
+        FSlateBrush Brush = PlaceholderIconBrush;
+        Brush.ImageSize = IconBrushTemplate.ImageSize;
+        ItemIcon->SetBrush(Brush);
+        ItemIcon->SetVisibility(ESlateVisibility::Visible);
+}
+
+void UInventorySlotWidget::HideIcon()
+{
+        DisplayedIconTexture.Reset();
+        if (UMO56ItemIconSubsystem* IconCache = UMO56ItemIconSubsystem::Get(this))
+        {
+                IconCache->ReleaseIconBrush(this);
+        }
+
+        FSlateBrush Brush = IconBrushTemplate;
+        Brush.SetResourceObject(nullptr);
+        ItemIcon->SetBrush(Brush);
+        ItemIcon->SetVisibility(ESlateVisibility::Hidden);
+}
+
 void UInventorySlotWidget::InitializeSlot(UInventoryComponent* Inventory, int32 InSlotIndex)
 {
         ObservedInventory = Inventory;
@@ -293,8 +369,70 @@ bool UInventorySlotWidget::CanInspectItem() const
         return !CachedStack.Item->KnowledgeTag.IsNone();
 }
 
+void UInventorySlotWidget::NativeOnInitialized()
+{
+        Super::NativeOnInitialized();
+
+        if (ItemIcon)
+        {
+                IconBrushTemplate = ItemIcon->GetBrush();
+        }
+
+        if (UMO56ItemIconSubsystem* IconCache = UMO56ItemIconSubsystem::Get(this))
+        {
+                IconCache->OnIconPacked.AddUObject(this, &UInventorySlotWidget::HandleIconPacked);
+        }
+}
+
+void UInventorySlotWidget::HandleIconPacked(const FSoftObjectPath& IconPath)
+{
+        UTexture2D* IconTexture = DisplayedIconTexture.Get();
+        if (ItemIcon && IconTexture && FSoftObjectPath(IconTexture) == IconPath)
+        {
+                ShowIconTexture(IconTexture);
+        }
+}
+
+void UInventorySlotWidget::NativeOnListItemObjectSet(UObject* ListItemObject)
+{
+        IUserObjectListEntry::NativeOnListItemObjectSet(ListItemObject);
+
+        BindToEntryData(Cast<UInventorySlotEntryData>(ListItemObject));
+}
+
+void UInventorySlotWidget::BindToEntryData(const UInventorySlotEntryData* EntryData)
+{
+        UInventoryComponent* Inventory = EntryData ? EntryData->Inventory.Get() : nullptr;
+        const int32 NewSlotIndex = EntryData ? EntryData->SlotIndex : INDEX_NONE;
+
+        // Recycled entry now represents another slot; a menu opened for the old one must not act on the new one.
+        if (ObservedInventory.Get() != Inventory || SlotIndex != NewSlotIndex)
+        {
+                CloseContextMenu();
+        }
+
+        InitializeSlot(Inventory, NewSlotIndex);
+        SetSkillSystem(EntryData ? EntryData->SkillSystem.Get() : nullptr);
+
+        FItemStack Stack;
+        if (Inventory)
+        {
+                Inventory->GetSlotAtIndex(NewSlotIndex, Stack);
+        }
+
+        SetItemStack(Stack);
+}
+
 void UInventorySlotWidget::NativeDestruct()
 {
+        // Drop any icon load still in flight for this slot, and the atlas cell its brush was sampling.
+        ++IconRequestSerial;
+        DisplayedIconTexture.Reset();
+        if (UMO56ItemIconSubsystem* IconCache = UMO56ItemIconSubsystem::Get(this))
+        {
+                IconCache->ReleaseIconBrush(this);
+        }
+
         CloseContextMenu();
         Super::NativeDestruct();
 }
@@ -3,17 +3,21 @@
 #include "Templates/SubclassOf.h"
 #include "Input/DragAndDrop.h"
 #include "Input/Reply.h"
+#include "Styling/SlateBrush.h"
 #include "Blueprint/UserWidget.h"
+#include "Blueprint/IUserObjectListEntry.h"
 #include "InventorySlotWidget.generated.h"
 
 class UImage;
 class UTextBlock;
 class USizeBox;
 class UInventoryComponent;
+class UInventorySlotEntryData;
 class UInventorySlotMenuWidget;
 class UInventorySlotDragVisual;
 class UDragDropOperation;
 class USkillSystemComponent;
+class UTexture2D;
 
 /**
  * Simple widget representing a single inventory slot.
@@ -24,9 +28,10 @@ class USkillSystemComponent;
  * 3. In the owning inventory panel Blueprint, call InitializeSlot to connect the widget to a specific inventory/slot index.
  * 4. Expose context actions (split, drop, destroy, inspect) through radial menus or buttons wired to Handle* helpers.
  * 5. Register the widget for inventory updates via IInventoryUpdateInterface so SetItemStack is triggered on refresh.
+ * 6. The same Blueprint can be used as the EntryWidgetClass of a virtualized inventory tile view; the entry reads its slot from UInventorySlotEntryData.
  */
 UCLASS()
-class MO56_API UInventorySlotWidget : public UUserWidget
+class MO56_API UInventorySlotWidget : public UUserWidget, public IUserObjectListEntry
 {
         GENERATED_BODY()
 
@@ -42,6 +47,9 @@ public:
          */
         void InitializeSlot(UInventoryComponent* Inventory, int32 InSlotIndex);
 
+        /** Points a tile view entry at the slot described by EntryData and shows its current contents. */
+        void BindToEntryData(const UInventorySlotEntryData* EntryData);
+
         /** Ensures the owning player controller has authority over the supplied inventory before mutating it. */
         void EnsureInventoryOwnership(UInventoryComponent* Inventory) const;
 
@@ -78,7 +86,9 @@ public:
         void SetSkillSystem(USkillSystemComponent* InSkillSystem);
 
 protected:
+        virtual void NativeOnInitialized() override;
         virtual void NativeDestruct() override;
+        virtual void NativeOnListItemObjectSet(UObject* ListItemObject) override;
         virtual FReply NativeOnMouseButtonDown(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent) override;
         virtual void NativeOnDragDetected(const FGeometry& InGeometry, const FPointerEvent& InMouseEvent, UDragDropOperation*& OutOperation) override;
         virtual bool NativeOnDrop(const FGeometry& InGeometry, const FDragDropEvent& InDragDropEvent, UDragDropOperation* InOperation) override;
@@ -97,6 +107,10 @@ protected:
         UPROPERTY(BlueprintReadOnly, meta=(BindWidgetOptional))
         TObjectPtr<USizeBox> QuantityBadge;
 
+        /** Brush shown in ItemIcon while the item's icon texture is still streaming in. */
+        UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Inventory")
+        FSlateBrush PlaceholderIconBrush;
+
 	/** Class used to spawn the slot context menu. */
 	UPROPERTY(EditAnywhere, Category = "Inventory")
 	TSubclassOf<UInventorySlotMenuWidget> ContextMenuClass;
@@ -119,5 +133,21 @@ protected:
 
         TWeakObjectPtr<USkillSystemComponent> SkillSystem;
 
+private:
+        void ShowIconTexture(UTexture2D* IconTexture);
+        void ShowIconPlaceholder();
+        void HideIcon();
+
+        /** Re-applies the displayed icon once the icon cache has moved it onto an atlas page. */
+        void HandleIconPacked(const FSoftObjectPath& IconPath);
+
+        /** Icon currently shown in ItemIcon, if any. */
+        TWeakObjectPtr<UTexture2D> DisplayedIconTexture;
+
+        /** ItemIcon's designer brush; icon textures and the placeholder are applied on top of its size and tint. */
+        FSlateBrush IconBrushTemplate;
+
+        /** Bumped on every SetItemStack so late icon loads for a previous stack are ignored. */
+        uint32 IconRequestSerial = 0;
 };
 
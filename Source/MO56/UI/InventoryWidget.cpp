@@ -2,10 +2,13 @@
 
 #include "Components/PanelWidget.h"
 #include "Components/TextBlock.h"
+#include "Components/TileView.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/Pawn.h"
 #include "InventoryComponent.h"
+#include "UI/InventorySlotEntryData.h"
 #include "UI/InventorySlotWidget.h"
+#include "UI/MO56ItemIconSubsystem.h"
 #include "Skills/SkillSystemComponent.h"
 
 
@@ -32,6 +35,11 @@ void UInventoryWidget::NativeDestruct()
         StopObservingOwningPlayer();
         SetInventoryComponent(nullptr);
 
+        if (UMO56ItemIconSubsystem* IconCache = UMO56ItemIconSubsystem::Get(this))
+        {
+                IconCache->UnpinIcons(this);
+        }
+
         Super::NativeDestruct();
 }
 
@@ -44,13 +52,17 @@ void UInventoryWidget::SetInventoryComponent(UInventoryComponent* NewInventory)
 
         if (UInventoryComponent* CurrentInventory = ObservedInventory.Get())
         {
+                CurrentInventory->OnInventoryChanged.RemoveDynamic(this, &UInventoryWidget::HandleInventoryChanged);
                 CurrentInventory->OnInventoryUpdated.RemoveDynamic(this, &UInventoryWidget::HandleInventoryComponentUpdated);
         }
 
         ObservedInventory = NewInventory;
+        PendingChangeSet = FInventoryChangeSet();
+        bHasPendingChangeSet = false;
 
         if (UInventoryComponent* Inventory = ObservedInventory.Get())
         {
+                Inventory->OnInventoryChanged.AddDynamic(this, &UInventoryWidget::HandleInventoryChanged);
                 Inventory->OnInventoryUpdated.AddDynamic(this, &UInventoryWidget::HandleInventoryComponentUpdated);
         }
 
@@ -68,6 +80,8 @@ void UInventoryWidget::SetSkillSystemComponent(USkillSystemComponent* SkillSyste
 
         if (ObservedInventory.IsValid())
         {
+                // Every slot needs the new skill system, so this is never a partial refresh.
+                bHasPendingChangeSet = false;
                 RefreshInventory(ObservedInventory.Get());
         }
 }
@@ -137,37 +151,275 @@ void UInventoryWidget::HandlePawnChanged(APawn* NewPawn)
 }
 
 void UInventoryWidget::RefreshInventory(UInventoryComponent* Inventory)
+{
+        // Sparse inventories are shown a page at a time so only that page is ever materialized.
+        const int32 TotalSlots = Inventory ? Inventory->GetNumSlots() : 0;
+        const bool bPaged = Inventory && Inventory->UsesSparseStorage() && SparsePageSize > 0;
+        SlotPage = bPaged ? FMath::Clamp(SlotPage, 0, FMath::Max(0, FMath::DivideAndRoundUp(TotalSlots, SparsePageSize) - 1)) : 0;
+        const int32 FirstSlot = bPaged ? SlotPage * SparsePageSize : 0;
+        const int32 NumSlots = bPaged ? FMath::Min(SparsePageSize, TotalSlots - FirstSlot) : TotalSlots;
+
+        // Only patch the slots named by the change set when it describes the inventory and page already on screen.
+        FInventoryChangeSet ChangeSet = MoveTemp(PendingChangeSet);
+        const bool bPartial = bHasPendingChangeSet && !ChangeSet.bLayoutChanged && Inventory && DisplayedInventory.Get() == Inventory
+                && DisplayedFirstSlot == FirstSlot;
+        PendingChangeSet = FInventoryChangeSet();
+        bHasPendingChangeSet = false;
+        DisplayedInventory = Inventory;
+        DisplayedFirstSlot = FirstSlot;
+
+        // Start streaming every icon this view needs before the slots ask for them one by one. Patches only add the
+        // icons of the slots they touch; the full rescan (and trim) waits for the next rebuild.
+        if (UMO56ItemIconSubsystem* IconCache = UMO56ItemIconSubsystem::Get(this))
+        {
+                if (bPartial)
+                {
+                        IconCache->PinSlotIcons(this, Inventory, ChangeSet.SlotIndices);
+                }
+                else
+                {
+                        IconCache->PinInventoryIcons(this, Inventory);
+                }
+        }
+
+        const bool bVirtualize = SlotsTileView && (!SlotsContainer || NumSlots >= VirtualizeSlotThreshold);
+
+        if (bVirtualize)
+        {
+                ReleaseGridSlots();
+                RefreshVirtualizedSlots(Inventory, FirstSlot, NumSlots, bPartial ? &ChangeSet : nullptr);
+        }
+        else
+        {
+                ReleaseVirtualizedSlots();
+                RefreshGridSlots(Inventory, FirstSlot, NumSlots, bPartial ? &ChangeSet : nullptr);
+        }
+}
+
+void UInventoryWidget::SetSlotPage(int32 NewPage)
+{
+        NewPage = FMath::Max(0, NewPage);
+        if (SlotPage == NewPage)
+        {
+                return;
+        }
+
+        SlotPage = NewPage;
+
+        if (ObservedInventory.IsValid())
+        {
+                bHasPendingChangeSet = false;
+                RefreshInventory(ObservedInventory.Get());
+        }
+}
+
+int32 UInventoryWidget::GetSlotPageCount() const
+{
+        const UInventoryComponent* Inventory = ObservedInventory.Get();
+        if (!Inventory || !Inventory->UsesSparseStorage() || SparsePageSize <= 0)
+        {
+                return 1;
+        }
+
+        return FMath::Max(1, FMath::DivideAndRoundUp(Inventory->GetNumSlots(), SparsePageSize));
+}
+
+void UInventoryWidget::RefreshGridSlots(UInventoryComponent* Inventory, int32 FirstSlot, int32 NumSlots, const FInventoryChangeSet* ChangeSet)
 {
         if (!SlotsContainer)
                 return;
 
-        SlotsContainer->ClearChildren();
-        SlotsContainer->SetSlotPadding(FMargin(4.f));
-        
+        SlotsContainer->SetVisibility(ESlateVisibility::Visible);
 
         if (!Inventory || !SlotWidgetClass)
+        {
+                ReleaseGridSlots();
+                return;
+        }
+
+        if (ChangeSet && DisplayedGridSlots == NumSlots)
+        {
+                FItemStack Stack;
+                for (const int32 SlotIndex : ChangeSet->SlotIndices)
+                {
+                        const int32 WidgetIndex = SlotIndex - FirstSlot;
+                        if (WidgetIndex >= 0 && WidgetIndex < NumSlots && SlotWidgetPool.IsValidIndex(WidgetIndex))
+                        {
+                                Inventory->GetSlotAtIndex(SlotIndex, Stack);
+                                SlotWidgetPool[WidgetIndex]->SetItemStack(Stack);
+                        }
+                }
+
                 return;
+        }
+
+        TArray<FItemStack> Slots;
+        Inventory->GetSlotPage(FirstSlot, NumSlots, Slots);
+
+        SlotsContainer->SetSlotPadding(FMargin(4.f));
 
-        const TArray<FItemStack>& Slots = Inventory->GetSlots();
-        for (int32 i = 0; i < Slots.Num(); ++i)
+        // A class swap invalidates the pool; otherwise widgets are only ever created when the inventory grows.
+        if (SlotWidgetPool.Num() > 0 && SlotWidgetPool[0]->GetClass() != SlotWidgetClass.Get())
+        {
+                ReleaseGridSlots();
+                SlotWidgetPool.Reset();
+        }
+
+        while (SlotWidgetPool.Num() < Slots.Num())
         {
                 UInventorySlotWidget* SlotWidget = CreateWidget<UInventorySlotWidget>(this, SlotWidgetClass);
-                if (!SlotWidget) continue;
+                if (!SlotWidget)
+                        break;
 
-                SlotWidget->InitializeSlot(Inventory, i);
+                SlotWidgetPool.Add(SlotWidget);
+        }
+
+        const int32 NumDisplayed = FMath::Min(Slots.Num(), SlotWidgetPool.Num());
+        for (int32 i = 0; i < NumDisplayed; ++i)
+        {
+                UInventorySlotWidget* SlotWidget = SlotWidgetPool[i];
+                SlotWidget->InitializeSlot(Inventory, FirstSlot + i);
                 SlotWidget->SetItemStack(Slots[i]);
                 SlotWidget->SetSkillSystem(ObservedSkillSystem.Get());
 
                 const int32 Row = Columns > 0 ? i / Columns : 0;
                 const int32 Col = Columns > 0 ? i % Columns : i;
 
-                UUniformGridSlot* GridSlot = SlotsContainer->AddChildToUniformGrid (SlotWidget, Row, Col);
-                if (GridSlot)
+                UUniformGridSlot* GridSlot = Cast<UUniformGridSlot>(SlotWidget->Slot);
+                if (!GridSlot || SlotWidget->GetParent() != SlotsContainer)
+                {
+                        GridSlot = SlotsContainer->AddChildToUniformGrid(SlotWidget, Row, Col);
+                        if (GridSlot)
+                        {
+                                GridSlot->SetHorizontalAlignment(HAlign_Center);
+                                GridSlot->SetVerticalAlignment(VAlign_Center);
+                        }
+                }
+                else
+                {
+                        GridSlot->SetRow(Row);
+                        GridSlot->SetColumn(Col);
+                }
+        }
+
+        // Surplus widgets stay pooled for the next larger inventory.
+        for (int32 i = NumDisplayed; i < DisplayedGridSlots && i < SlotWidgetPool.Num(); ++i)
+        {
+                SlotWidgetPool[i]->CloseContextMenu();
+                SlotWidgetPool[i]->RemoveFromParent();
+        }
+
+        DisplayedGridSlots = NumDisplayed;
+}
+
+void UInventoryWidget::RefreshVirtualizedSlots(UInventoryComponent* Inventory, int32 FirstSlot, int32 NumSlots, const FInventoryChangeSet* ChangeSet)
+{
+        SlotsTileView->SetVisibility(ESlateVisibility::Visible);
+
+        if (ChangeSet && DisplayedTileSlots == NumSlots)
+        {
+                FItemStack Stack;
+                for (const int32 SlotIndex : ChangeSet->SlotIndices)
                 {
-                        GridSlot->SetHorizontalAlignment(HAlign_Center);
-                        GridSlot->SetVerticalAlignment(VAlign_Center);
+                        const int32 EntryIndex = SlotIndex - FirstSlot;
+                        if (EntryIndex < 0 || EntryIndex >= NumSlots || !SlotEntryPool.IsValidIndex(EntryIndex))
+                        {
+                                continue;
+                        }
+
+                        // Slots scrolled out of view have no entry widget; they read fresh data when they scroll back in.
+                        if (UInventorySlotWidget* Entry = SlotsTileView->GetEntryWidgetFromItem<UInventorySlotWidget>(SlotEntryPool[EntryIndex].Get()))
+                        {
+                                Inventory->GetSlotAtIndex(SlotIndex, Stack);
+                                Entry->SetItemStack(Stack);
+                        }
                 }
+
+                return;
         }
+
+        while (SlotEntryPool.Num() < NumSlots)
+        {
+                SlotEntryPool.Add(NewObject<UInventorySlotEntryData>(this));
+        }
+
+        TArray<UObject*> ListItems;
+        ListItems.Reserve(NumSlots);
+        for (int32 i = 0; i < NumSlots; ++i)
+        {
+                UInventorySlotEntryData* EntryData = SlotEntryPool[i];
+                EntryData->Inventory = Inventory;
+                EntryData->SkillSystem = ObservedSkillSystem;
+                EntryData->SlotIndex = FirstSlot + i;
+                ListItems.Add(EntryData);
+        }
+
+        SlotsTileView->SetListItems(ListItems);
+
+        // Entries whose item object did not change are not re-assigned by the view, so push the new data into them.
+        for (UUserWidget* Entry : SlotsTileView->GetDisplayedEntryWidgets())
+        {
+                if (UInventorySlotWidget* SlotWidget = Cast<UInventorySlotWidget>(Entry))
+                {
+                        SlotWidget->BindToEntryData(Cast<UInventorySlotEntryData>(SlotsTileView->ItemFromEntryWidget(*Entry)));
+                }
+        }
+
+        DisplayedTileSlots = NumSlots;
+}
+
+void UInventoryWidget::ReleaseGridSlots()
+{
+        for (int32 i = 0; i < DisplayedGridSlots && i < SlotWidgetPool.Num(); ++i)
+        {
+                SlotWidgetPool[i]->CloseContextMenu();
+                SlotWidgetPool[i]->RemoveFromParent();
+        }
+
+        DisplayedGridSlots = 0;
+
+        if (SlotsContainer && SlotsTileView)
+        {
+                SlotsContainer->SetVisibility(ESlateVisibility::Collapsed);
+        }
+}
+
+void UInventoryWidget::ReleaseVirtualizedSlots()
+{
+        if (!SlotsTileView)
+        {
+                return;
+        }
+
+        if (DisplayedTileSlots > 0)
+        {
+                SlotsTileView->ClearListItems();
+                DisplayedTileSlots = 0;
+        }
+
+        SlotsTileView->SetVisibility(ESlateVisibility::Collapsed);
+}
+
+void UInventoryWidget::HandleInventoryChanged(const FInventoryChangeSet& ChangeSet)
+{
+        if (ChangeSet.bLayoutChanged)
+        {
+                PendingChangeSet.bLayoutChanged = true;
+                PendingChangeSet.SlotIndices.Reset();
+        }
+        else if (!PendingChangeSet.bLayoutChanged)
+        {
+                // Blueprint overrides of OnUpdateInventory may not consume the set; fall back to a rebuild rather than grow without bound.
+                const int32 NumSlots = ObservedInventory.IsValid() ? ObservedInventory->GetNumSlots() : 0;
+                PendingChangeSet.SlotIndices.Append(ChangeSet.SlotIndices);
+                if (PendingChangeSet.SlotIndices.Num() > NumSlots)
+                {
+                        PendingChangeSet.bLayoutChanged = true;
+                        PendingChangeSet.SlotIndices.Reset();
+                }
+        }
+
+        bHasPendingChangeSet = true;
 }
 
 void UInventoryWidget::HandleInventoryComponentUpdated()
@@ -3,14 +3,17 @@
 #include "Components/UniformGridPanel.h"
 #include "Components/UniformGridSlot.h"
 #include "Blueprint/UserWidget.h"
+#include "InventoryComponent.h"
 #include "InventoryUpdateInterface.h"
 #include "InventoryWidget.generated.h"
 
 class APawn;
 class UInventoryComponent;
+class UInventorySlotEntryData;
 class UInventorySlotWidget;
 class UPanelWidget;
 class UTextBlock;
+class UTileView;
 class USkillSystemComponent;
 
 /**
@@ -22,6 +25,10 @@ class USkillSystemComponent;
  * 3. Bind Weight/Volume text blocks to display aggregated stats via UpdateInventoryStats.
  * 4. Set bAutoBindToOwningPawn when the widget lives in the HUD so it auto-discovers the player's inventory component.
  * 5. Implement OnUpdateInventory in Blueprint (or rely on the C++ default) to refresh slot visuals whenever notified.
+ * 6. For large containers also bind a TileView named SlotsTileView (EntryWidgetClass = your slot Blueprint); inventories with
+ *    at least VirtualizeSlotThreshold slots are shown there so only the visible rows own widgets.
+ * 7. Inventories using sparse slot storage are shown SparsePageSize slots at a time; wire page buttons to SetSlotPage
+ *    and GetSlotPageCount so only the visible page is ever materialized.
  */
 UCLASS()
 class MO56_API UInventoryWidget : public UUserWidget, public IInventoryUpdateInterface
@@ -46,11 +53,26 @@ public:
 
         virtual void OnUpdateInventory_Implementation(UInventoryComponent* Inventory) override;
 
+        /** Shows the given page of a sparse inventory. Clamped to the available pages on the next refresh. */
+        UFUNCTION(BlueprintCallable, Category = "Inventory")
+        void SetSlotPage(int32 NewPage);
+
+        UFUNCTION(BlueprintPure, Category = "Inventory")
+        int32 GetSlotPage() const { return SlotPage; }
+
+        /** Number of pages the observed inventory spans; 1 unless it uses sparse slot storage. */
+        UFUNCTION(BlueprintPure, Category = "Inventory")
+        int32 GetSlotPageCount() const;
+
 protected:
         /** Container that holds the generated inventory slot widgets. */
         UPROPERTY(BlueprintReadOnly, meta = (BindWidgetOptional))
         UUniformGridPanel* SlotsContainer = nullptr;
 
+        /** Optional virtualized view used instead of SlotsContainer for inventories with many slots. */
+        UPROPERTY(BlueprintReadOnly, meta = (BindWidgetOptional))
+        UTileView* SlotsTileView = nullptr;
+
         /** Displays the total weight stored in the inventory. */
         UPROPERTY(BlueprintReadOnly, meta = (BindWidgetOptional))
         UTextBlock* WeightTotal = nullptr;
@@ -74,6 +96,14 @@ protected:
         UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Inventory")
         TSubclassOf<UInventorySlotWidget> SlotWidgetClass;
 
+        /** Slot count from which SlotsTileView (when bound) replaces the uniform grid. */
+        UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Inventory", meta = (ClampMin = "0"))
+        int32 VirtualizeSlotThreshold = 96;
+
+        /** Slots shown per page for inventories using sparse slot storage. 0 shows every slot at once. */
+        UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Inventory", meta = (ClampMin = "0"))
+        int32 SparsePageSize = 200;
+
         /** Whether the widget should automatically track the owning controller's pawn inventory. */
         UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Inventory")
         bool bAutoBindToOwningPawn = true;
@@ -84,11 +114,40 @@ private:
         void BindToInventoryFromPawn(APawn* Pawn);
         void HandlePawnChanged(APawn* NewPawn);
         void RefreshInventory(UInventoryComponent* Inventory);
+        void RefreshGridSlots(UInventoryComponent* Inventory, int32 FirstSlot, int32 NumSlots, const FInventoryChangeSet* ChangeSet);
+        void RefreshVirtualizedSlots(UInventoryComponent* Inventory, int32 FirstSlot, int32 NumSlots, const FInventoryChangeSet* ChangeSet);
+        void ReleaseGridSlots();
+        void ReleaseVirtualizedSlots();
         void UpdateInventoryStats(UInventoryComponent* Inventory);
 
         UFUNCTION()
         void HandleInventoryComponentUpdated();
 
+        UFUNCTION()
+        void HandleInventoryChanged(const FInventoryChangeSet& ChangeSet);
+
+        /** Slot widgets reused across refreshes; the first DisplayedGridSlots are parented to SlotsContainer. */
+        UPROPERTY(Transient)
+        TArray<TObjectPtr<UInventorySlotWidget>> SlotWidgetPool;
+
+        /** One list item per slot for SlotsTileView; the tile view recycles the entry widgets. */
+        UPROPERTY(Transient)
+        TArray<TObjectPtr<UInventorySlotEntryData>> SlotEntryPool;
+
+        int32 DisplayedGridSlots = 0;
+        int32 DisplayedTileSlots = 0;
+
+        /** Inventory slot shown in the first widget; non-zero only while paging through a sparse inventory. */
+        int32 DisplayedFirstSlot = 0;
+        int32 SlotPage = 0;
+
+        /** Inventory the displayed slots were built for; a different inventory always forces a full refresh. */
+        TWeakObjectPtr<UInventoryComponent> DisplayedInventory;
+
+        /** Slots reported by OnInventoryChanged since the last refresh. */
+        FInventoryChangeSet PendingChangeSet;
+        bool bHasPendingChangeSet = false;
+
         TWeakObjectPtr<UInventoryComponent> ObservedInventory;
         TWeakObjectPtr<USkillSystemComponent> ObservedSkillSystem;
         FDelegateHandle PawnChangedHandle;
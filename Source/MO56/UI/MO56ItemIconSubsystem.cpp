@@ -0,0 +1,503 @@
+// Implementation: Streams item icons through the asset manager's streamable manager, fans completed
+// loads out to every waiting slot and keeps pinned icons resident for as long as an inventory view is open.
+// Each loaded icon is drawn once into a cell of an atlas render target; slot brushes then sample that
+// page through a UV sub-rect, so Slate can batch a whole grid instead of switching texture per slot.
+#include "UI/MO56ItemIconSubsystem.h"
+
+#include "Engine/AssetManager.h"
+#include "Engine/Canvas.h"
+#include "Engine/GameInstance.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/Texture2D.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "InventoryComponent.h"
+#include "ItemData.h"
+#include "Kismet/KismetRenderingLibrary.h"
+#include "Misc/App.h"
+#include "Styling/SlateBrush.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogMO56ItemIcons, Log, All);
+
+namespace
+{
+        static TAutoConsoleVariable<int32> CVarIconCacheSize(
+                TEXT("MO56.UI.IconCacheSize"),
+                256,
+                TEXT("Number of unpinned item icons kept resident after the inventory views that used them close."),
+                ECVF_Default);
+
+        static TAutoConsoleVariable<int32> CVarIconAtlas(
+                TEXT("MO56.UI.IconAtlas"),
+                1,
+                TEXT("Pack loaded item icons into shared atlas textures so inventory grids draw in a few Slate batches."),
+                ECVF_Default);
+
+        static TAutoConsoleVariable<int32> CVarIconAtlasCellSize(
+                TEXT("MO56.UI.IconAtlasCellSize"),
+                128,
+                TEXT("Edge length (px) of one icon cell in the atlas. Read when the first atlas page is created."),
+                ECVF_Default);
+
+        static TAutoConsoleVariable<int32> CVarIconAtlasPageSize(
+                TEXT("MO56.UI.IconAtlasPageSize"),
+                1024,
+                TEXT("Edge length (px) of one atlas page. Read when the first atlas page is created."),
+                ECVF_Default);
+
+        /** How often icons waiting on texture streaming are checked for packing. */
+        constexpr float PackRetryIntervalSeconds = 0.2f;
+
+        static TAutoConsoleVariable<int32> CVarIconAtlasMaxPages(
+                TEXT("MO56.UI.IconAtlasMaxPages"),
+                4,
+                TEXT("Maximum number of atlas pages; icons that do not fit are drawn from their own texture."),
+                ECVF_Default);
+
+        /** Transparent border around each packed icon so bilinear sampling never bleeds into the neighbouring cell. */
+        constexpr int32 AtlasCellPadding = 1;
+}
+
+void UMO56ItemIconSubsystem::Deinitialize()
+{
+        if (PackRetryHandle.IsValid())
+        {
+                FTSTicker::GetCoreTicker().RemoveTicker(PackRetryHandle);
+                PackRetryHandle.Reset();
+        }
+
+        for (TPair<FSoftObjectPath, FPendingIconLoad>& Pair : PendingLoads)
+        {
+                if (Pair.Value.Handle.IsValid())
+                {
+                        Pair.Value.Handle->CancelHandle();
+                }
+        }
+
+        PendingLoads.Empty();
+        ResidentIcons.Empty();
+        Pins.Empty();
+        AtlasPages.Empty();
+        AtlasCells.Empty();
+        FreeAtlasCells.Empty();
+        AtlasBrushUsers.Empty();
+        IconsAwaitingPack.Empty();
+        NextAtlasCell = 0;
+
+        Super::Deinitialize();
+}
+
+UMO56ItemIconSubsystem* UMO56ItemIconSubsystem::Get(const UObject* WorldContextObject)
+{
+        if (!WorldContextObject)
+        {
+                return nullptr;
+        }
+
+        if (const UWorld* World = WorldContextObject->GetWorld())
+        {
+                if (UGameInstance* GameInstance = World->GetGameInstance())
+                {
+                        return GameInstance->GetSubsystem<UMO56ItemIconSubsystem>();
+                }
+        }
+
+        return nullptr;
+}
+
+UTexture2D* UMO56ItemIconSubsystem::FindIcon(const UItemData* Item) const
+{
+        if (!Item || Item->Icon.IsNull())
+        {
+                return nullptr;
+        }
+
+        if (const TObjectPtr<UTexture2D>* Resident = ResidentIcons.Find(Item->Icon.ToSoftObjectPath()))
+        {
+                return Resident->Get();
+        }
+
+        // Loaded by someone else (e.g. referenced by an open menu); cheap to hand out without a request.
+        return Item->Icon.Get();
+}
+
+UTexture2D* UMO56ItemIconSubsystem::RequestIcon(const UItemData* Item, FOnItemIconLoaded OnLoaded)
+{
+        if (!Item || Item->Icon.IsNull())
+        {
+                return nullptr;
+        }
+
+        const FSoftObjectPath IconPath = Item->Icon.ToSoftObjectPath();
+        if (const TObjectPtr<UTexture2D>* Resident = ResidentIcons.Find(IconPath))
+        {
+                UTexture2D* Icon = Resident->Get();
+                PackIcon(IconPath, Icon);
+                return Icon;
+        }
+
+        if (UTexture2D* AlreadyLoaded = Item->Icon.Get())
+        {
+                ResidentIcons.Add(IconPath, AlreadyLoaded);
+                PackIcon(IconPath, AlreadyLoaded);
+                return AlreadyLoaded;
+        }
+
+        StartLoad(IconPath, MoveTemp(OnLoaded));
+        return nullptr;
+}
+
+void UMO56ItemIconSubsystem::PinInventoryIcons(const UObject* Pinner, const UInventoryComponent* Inventory)
+{
+        if (!Pinner)
+        {
+                return;
+        }
+
+        if (!Inventory)
+        {
+                UnpinIcons(Pinner);
+                return;
+        }
+
+        TSet<FSoftObjectPath>& Pinned = Pins.FindOrAdd(Pinner);
+        Pinned.Reset();
+
+        for (const FItemStack& Stack : Inventory->GetStoredSlots())
+        {
+                PinItemIcon(Pinned, Stack.Item);
+        }
+
+        TrimUnpinnedIcons();
+}
+
+void UMO56ItemIconSubsystem::PinSlotIcons(const UObject* Pinner, const UInventoryComponent* Inventory, TConstArrayView<int32> SlotIndices)
+{
+        if (!Pinner || !Inventory)
+        {
+                return;
+        }
+
+        TSet<FSoftObjectPath>& Pinned = Pins.FindOrAdd(Pinner);
+
+        FItemStack Stack;
+        for (const int32 SlotIndex : SlotIndices)
+        {
+                Inventory->GetSlotAtIndex(SlotIndex, Stack);
+                PinItemIcon(Pinned, Stack.Item);
+        }
+}
+
+void UMO56ItemIconSubsystem::PinItemIcon(TSet<FSoftObjectPath>& Pinned, const UItemData* Item)
+{
+        if (!Item || Item->Icon.IsNull())
+        {
+                return;
+        }
+
+        bool bAlreadyPinned = false;
+        const FSoftObjectPath IconPath = Item->Icon.ToSoftObjectPath();
+        Pinned.Add(IconPath, &bAlreadyPinned);
+        if (bAlreadyPinned || ResidentIcons.Contains(IconPath))
+        {
+                return;
+        }
+
+        if (UTexture2D* AlreadyLoaded = Item->Icon.Get())
+        {
+                ResidentIcons.Add(IconPath, AlreadyLoaded);
+                PackIcon(IconPath, AlreadyLoaded);
+                return;
+        }
+
+        StartLoad(IconPath, FOnItemIconLoaded());
+}
+
+void UMO56ItemIconSubsystem::UnpinIcons(const UObject* Pinner)
+{
+        if (Pins.Remove(Pinner) > 0)
+        {
+                TrimUnpinnedIcons();
+        }
+}
+
+void UMO56ItemIconSubsystem::StartLoad(const FSoftObjectPath& IconPath, FOnItemIconLoaded OnLoaded)
+{
+        FPendingIconLoad& Pending = PendingLoads.FindOrAdd(IconPath);
+        if (OnLoaded.IsBound())
+        {
+                Pending.Callbacks.Add(MoveTemp(OnLoaded));
+        }
+
+        if (Pending.Handle.IsValid())
+        {
+                return;
+        }
+
+        FStreamableManager& Streamable = UAssetManager::GetStreamableManager();
+        TSharedPtr<FStreamableHandle> Handle = Streamable.RequestAsyncLoad(
+                IconPath,
+                FStreamableDelegate::CreateUObject(this, &UMO56ItemIconSubsystem::HandleIconLoaded, IconPath),
+                FStreamableManager::AsyncLoadHighPriority);
+
+        // The delegate may already have run (and removed the entry) if the texture was loaded in between.
+        if (FPendingIconLoad* StillPending = PendingLoads.Find(IconPath))
+        {
+                if (Handle.IsValid())
+                {
+                        StillPending->Handle = MoveTemp(Handle);
+                }
+                else
+                {
+                        // The streamable manager rejected the path; answer the waiters right away.
+                        HandleIconLoaded(IconPath);
+                }
+        }
+}
+
+void UMO56ItemIconSubsystem::HandleIconLoaded(FSoftObjectPath IconPath)
+{
+        FPendingIconLoad Pending;
+        if (!PendingLoads.RemoveAndCopyValue(IconPath, Pending))
+        {
+                return;
+        }
+
+        UTexture2D* Icon = Cast<UTexture2D>(IconPath.ResolveObject());
+        if (Icon)
+        {
+                ResidentIcons.Add(IconPath, Icon);
+                PackIcon(IconPath, Icon);
+        }
+        else
+        {
+                UE_LOG(LogMO56ItemIcons, Warning, TEXT("Icon %s failed to load"), *IconPath.ToString());
+        }
+
+        // The texture is referenced by ResidentIcons now, so the streaming handle can go.
+        if (Pending.Handle.IsValid())
+        {
+                Pending.Handle->ReleaseHandle();
+        }
+
+        for (FOnItemIconLoaded& Callback : Pending.Callbacks)
+        {
+                Callback.ExecuteIfBound(Icon);
+        }
+}
+
+void UMO56ItemIconSubsystem::TrimUnpinnedIcons()
+{
+        TSet<FSoftObjectPath> Pinned;
+        for (auto It = Pins.CreateIterator(); It; ++It)
+        {
+                if (!It.Key().IsValid())
+                {
+                        It.RemoveCurrent();
+                        continue;
+                }
+
+                Pinned.Append(It.Value());
+        }
+
+        // An icon a live brush still samples from the atlas counts as pinned: freeing its cell would let the next
+        // packed icon draw over it while that brush is on screen.
+        for (auto It = AtlasBrushUsers.CreateIterator(); It; ++It)
+        {
+                if (!It.Key().IsValid())
+                {
+                        It.RemoveCurrent();
+                        continue;
+                }
+
+                Pinned.Add(It.Value());
+        }
+
+        int32 Unpinned = 0;
+        for (const TPair<FSoftObjectPath, TObjectPtr<UTexture2D>>& Pair : ResidentIcons)
+        {
+                Unpinned += Pinned.Contains(Pair.Key) ? 0 : 1;
+        }
+
+        int32 Excess = Unpinned - FMath::Max(0, CVarIconCacheSize.GetValueOnGameThread());
+        if (Excess <= 0)
+        {
+                return;
+        }
+
+        // Oldest entries first; the map keeps insertion order between removals.
+        for (auto It = ResidentIcons.CreateIterator(); It && Excess > 0; ++It)
+        {
+                if (!Pinned.Contains(It.Key()))
+                {
+                        ReleaseAtlasCell(It.Key());
+                        IconsAwaitingPack.Remove(It.Key());
+                        It.RemoveCurrent();
+                        --Excess;
+                }
+        }
+}
+
+bool UMO56ItemIconSubsystem::CanUseAtlas() const
+{
+        return CVarIconAtlas.GetValueOnGameThread() != 0 && FApp::CanEverRender() && GetWorld() != nullptr;
+}
+
+void UMO56ItemIconSubsystem::PackIcon(const FSoftObjectPath& IconPath, UTexture2D* Icon)
+{
+        if (!Icon || AtlasCells.Contains(IconPath) || !CanUseAtlas())
+        {
+                return;
+        }
+
+        // Packing a partially streamed texture would bake its low mip into the atlas for good; wait for the rest.
+        if (!Icon->GetResource() || !Icon->IsFullyStreamedIn())
+        {
+                IconsAwaitingPack.Add(IconPath);
+                if (!PackRetryHandle.IsValid())
+                {
+                        PackRetryHandle = FTSTicker::GetCoreTicker().AddTicker(
+                                FTickerDelegate::CreateUObject(this, &UMO56ItemIconSubsystem::RetryPendingPacks), PackRetryIntervalSeconds);
+                }
+                return;
+        }
+
+        IconsAwaitingPack.Remove(IconPath);
+
+        if (AtlasCellSize == 0)
+        {
+                AtlasCellSize = FMath::Clamp(CVarIconAtlasCellSize.GetValueOnGameThread(), 16, 512);
+                const int32 PageSize = FMath::Clamp(CVarIconAtlasPageSize.GetValueOnGameThread(), AtlasCellSize, 4096);
+                AtlasCellsPerRow = PageSize / AtlasCellSize;
+        }
+
+        const int32 CellsPerPage = AtlasCellsPerRow * AtlasCellsPerRow;
+        const int32 PageSize = AtlasCellsPerRow * AtlasCellSize;
+
+        int32 Cell = INDEX_NONE;
+        if (FreeAtlasCells.Num() > 0)
+        {
+                Cell = FreeAtlasCells.Pop(EAllowShrinking::No);
+        }
+        else if (NextAtlasCell < CellsPerPage * FMath::Max(0, CVarIconAtlasMaxPages.GetValueOnGameThread()))
+        {
+                Cell = NextAtlasCell++;
+        }
+        else
+        {
+                return;
+        }
+
+        const int32 PageIndex = Cell / CellsPerPage;
+        while (AtlasPages.Num() <= PageIndex)
+        {
+                UTextureRenderTarget2D* Page = UKismetRenderingLibrary::CreateRenderTarget2D(this, PageSize, PageSize, RTF_RGBA8_SRGB, FLinearColor::Transparent);
+                if (!Page)
+                {
+                        UE_LOG(LogMO56ItemIcons, Warning, TEXT("Failed to create icon atlas page %d"), AtlasPages.Num());
+                        FreeAtlasCells.Add(Cell);
+                        return;
+                }
+
+                AtlasPages.Add(Page);
+        }
+
+        const int32 LocalCell = Cell % CellsPerPage;
+        const FVector2D CellOrigin((LocalCell % AtlasCellsPerRow) * AtlasCellSize, (LocalCell / AtlasCellsPerRow) * AtlasCellSize);
+        const FVector2D InnerSize(AtlasCellSize - 2 * AtlasCellPadding);
+
+        UCanvas* Canvas = nullptr;
+        FVector2D CanvasSize;
+        FDrawToRenderTargetContext DrawContext;
+        UKismetRenderingLibrary::BeginDrawCanvasToRenderTarget(this, AtlasPages[PageIndex], Canvas, CanvasSize, DrawContext);
+        if (Canvas)
+        {
+                // Opaque so the cell is overwritten rather than blended with whatever icon used it before.
+                Canvas->K2_DrawTexture(Icon, CellOrigin + FVector2D(AtlasCellPadding), InnerSize, FVector2D::ZeroVector, FVector2D::UnitVector, FLinearColor::White, BLEND_Opaque);
+        }
+        UKismetRenderingLibrary::EndDrawCanvasToRenderTarget(this, DrawContext);
+
+        AtlasCells.Add(IconPath, Cell);
+}
+
+bool UMO56ItemIconSubsystem::RetryPendingPacks(float DeltaTime)
+{
+        TArray<FSoftObjectPath, TInlineAllocator<8>> Packed;
+        for (const FSoftObjectPath& IconPath : IconsAwaitingPack.Array())
+        {
+                const TObjectPtr<UTexture2D>* Resident = ResidentIcons.Find(IconPath);
+                if (!Resident || !Resident->Get())
+                {
+                        IconsAwaitingPack.Remove(IconPath);
+                        continue;
+                }
+
+                PackIcon(IconPath, Resident->Get());
+                if (AtlasCells.Contains(IconPath))
+                {
+                        Packed.Add(IconPath);
+                }
+                else if (Resident->Get()->IsFullyStreamedIn())
+                {
+                        // Streamed but the atlas is full; it stays on its own texture.
+                        IconsAwaitingPack.Remove(IconPath);
+                }
+        }
+
+        for (const FSoftObjectPath& IconPath : Packed)
+        {
+                OnIconPacked.Broadcast(IconPath);
+        }
+
+        if (IconsAwaitingPack.Num() == 0)
+        {
+                PackRetryHandle.Reset();
+                return false;
+        }
+
+        return true;
+}
+
+void UMO56ItemIconSubsystem::ReleaseAtlasCell(const FSoftObjectPath& IconPath)
+{
+        int32 Cell = INDEX_NONE;
+        if (AtlasCells.RemoveAndCopyValue(IconPath, Cell))
+        {
+                FreeAtlasCells.Add(Cell);
+        }
+}
+
+void UMO56ItemIconSubsystem::ReleaseIconBrush(const UObject* BrushUser)
+{
+        AtlasBrushUsers.Remove(BrushUser);
+}
+
+void UMO56ItemIconSubsystem::ApplyIconToBrush(UTexture2D* Icon, FSlateBrush& InOutBrush, const UObject* BrushUser)
+{
+        const FSoftObjectPath IconPath(Icon);
+        const int32* Cell = (Icon && CVarIconAtlas.GetValueOnGameThread() != 0) ? AtlasCells.Find(IconPath) : nullptr;
+        const int32 CellsPerPage = AtlasCellsPerRow * AtlasCellsPerRow;
+        if (!Cell || CellsPerPage <= 0 || !AtlasPages.IsValidIndex(*Cell / CellsPerPage))
+        {
+                ReleaseIconBrush(BrushUser);
+                InOutBrush.SetResourceObject(Icon);
+                InOutBrush.SetUVRegion(FBox2f(ForceInit));
+                return;
+        }
+
+        if (BrushUser)
+        {
+                AtlasBrushUsers.Add(BrushUser, IconPath);
+        }
+
+        const int32 LocalCell = *Cell % CellsPerPage;
+        const float PageSize = static_cast<float>(AtlasCellsPerRow * AtlasCellSize);
+        const FVector2f Min(
+                ((LocalCell % AtlasCellsPerRow) * AtlasCellSize + AtlasCellPadding) / PageSize,
+                ((LocalCell / AtlasCellsPerRow) * AtlasCellSize + AtlasCellPadding) / PageSize);
+        const FVector2f Size((AtlasCellSize - 2 * AtlasCellPadding) / PageSize);
+
+        InOutBrush.SetResourceObject(AtlasPages[*Cell / CellsPerPage]);
+        InOutBrush.SetUVRegion(FBox2f(Min, Min + Size));
+}
@@ -0,0 +1,142 @@
+// Implementation: Game-instance cache for inventory item icons. Textures are streamed asynchronously,
+// kept resident while an inventory view pins them and trimmed back to MO56.UI.IconCacheSize unpinned
+// entries afterwards, so slot widgets never block the game thread on LoadSynchronous. Loaded icons are
+// also copied into a few shared atlas render targets so a full grid draws from one texture.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "UObject/SoftObjectPath.h"
+#include "MO56ItemIconSubsystem.generated.h"
+
+class UInventoryComponent;
+class UItemData;
+class UTexture2D;
+class UTextureRenderTarget2D;
+struct FSlateBrush;
+struct FStreamableHandle;
+
+/** Fired once an icon request finishes; the texture is nullptr when the asset failed to load. */
+DECLARE_DELEGATE_OneParam(FOnItemIconLoaded, UTexture2D* /*Icon*/);
+
+/** Fired when an icon that was being drawn from its own texture has been copied onto an atlas page. */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnItemIconPacked, const FSoftObjectPath& /*IconPath*/);
+
+/**
+ * Asynchronous item icon cache shared by every inventory widget.
+ *
+ * Editor Implementation Guide:
+ * 1. No setup is required; the subsystem is created with the game instance.
+ * 2. Slot widgets call RequestIcon and show their placeholder brush until the callback delivers the texture.
+ * 3. Inventory panels call PinInventoryIcons with themselves as the pinner so every owned or viewed item icon
+ *    starts streaming as soon as the panel opens, and UnpinIcons when they close.
+ * 4. Raise MO56.UI.IconCacheSize if icons for recently closed containers should stay resident longer.
+ * 5. Slots build their brush through ApplyIconToBrush so packed icons point at an atlas page sub-rect; set
+ *    MO56.UI.IconAtlas 0 to draw the source textures directly (e.g. when comparing batch counts).
+ * 6. Anything holding such a brush passes itself as the brush user and calls ReleaseIconBrush when it stops showing
+ *    the icon, and re-applies the icon on OnIconPacked; atlas cells are only reused once no live brush samples them.
+ */
+UCLASS()
+class MO56_API UMO56ItemIconSubsystem : public UGameInstanceSubsystem
+{
+        GENERATED_BODY()
+
+public:
+        virtual void Deinitialize() override;
+
+        static UMO56ItemIconSubsystem* Get(const UObject* WorldContextObject);
+
+        /**
+         * Returns Item's icon when it is already resident. Otherwise starts (or joins) an async load and
+         * returns nullptr; OnLoaded fires on the game thread when the load finishes.
+         */
+        UTexture2D* RequestIcon(const UItemData* Item, FOnItemIconLoaded OnLoaded);
+
+        /** Returns Item's icon only if it is resident; never starts a load. */
+        UTexture2D* FindIcon(const UItemData* Item) const;
+
+        /**
+         * Points InOutBrush at Icon, keeping the brush's size and tint. Packed icons reference their atlas page and
+         * sub-rect so every slot using the same page shares one Slate batch; others fall back to the texture itself.
+         * BrushUser holds a reference on the atlas cell until it applies another icon, calls ReleaseIconBrush or dies.
+         */
+        void ApplyIconToBrush(UTexture2D* Icon, FSlateBrush& InOutBrush, const UObject* BrushUser);
+
+        /** Drops BrushUser's reference on the atlas cell it was sampling, if any. */
+        void ReleaseIconBrush(const UObject* BrushUser);
+
+        /** See FOnItemIconPacked; brush users showing that icon should apply it again to move onto the atlas. */
+        FOnItemIconPacked OnIconPacked;
+
+        /** Replaces Pinner's pinned set with the icons of every item stored in Inventory and streams the missing ones. */
+        void PinInventoryIcons(const UObject* Pinner, const UInventoryComponent* Inventory);
+
+        /**
+         * Adds the icons of the listed slots to Pinner's pinned set and streams the missing ones. Touches only those
+         * slots and never trims, so it suits incremental slot patches; PinInventoryIcons resynchronizes the whole set.
+         */
+        void PinSlotIcons(const UObject* Pinner, const UInventoryComponent* Inventory, TConstArrayView<int32> SlotIndices);
+
+        /** Releases every icon pinned by Pinner; they become eligible for trimming. */
+        void UnpinIcons(const UObject* Pinner);
+
+        int32 GetResidentIconCount() const { return ResidentIcons.Num(); }
+        int32 GetPendingIconCount() const { return PendingLoads.Num(); }
+        int32 GetAtlasPageCount() const { return AtlasPages.Num(); }
+
+private:
+        struct FPendingIconLoad
+        {
+                TSharedPtr<FStreamableHandle> Handle;
+                TArray<FOnItemIconLoaded> Callbacks;
+        };
+
+        /** Adds Item's icon to Pinned and makes it resident or starts its load. */
+        void PinItemIcon(TSet<FSoftObjectPath>& Pinned, const UItemData* Item);
+
+        void StartLoad(const FSoftObjectPath& IconPath, FOnItemIconLoaded OnLoaded);
+        void HandleIconLoaded(FSoftObjectPath IconPath);
+        void TrimUnpinnedIcons();
+
+        /** Copies a resident icon into a free atlas cell; icons that cannot be packed yet are retried on the next request. */
+        void PackIcon(const FSoftObjectPath& IconPath, UTexture2D* Icon);
+        void ReleaseAtlasCell(const FSoftObjectPath& IconPath);
+        bool CanUseAtlas() const;
+
+        /** Packs icons that were still streaming when first seen, then announces them through OnIconPacked. */
+        bool RetryPendingPacks(float DeltaTime);
+
+        /** Loaded icons; the UPROPERTY keeps them alive independently of the streaming handles. */
+        UPROPERTY(Transient)
+        TMap<FSoftObjectPath, TObjectPtr<UTexture2D>> ResidentIcons;
+
+        /** In-flight loads keyed by icon path so concurrent requests share one handle. */
+        TMap<FSoftObjectPath, FPendingIconLoad> PendingLoads;
+
+        /** Icons each open inventory view needs resident. */
+        TMap<TWeakObjectPtr<const UObject>, TSet<FSoftObjectPath>> Pins;
+
+        /** Square render targets split into a uniform grid of AtlasCellSize cells. */
+        UPROPERTY(Transient)
+        TArray<TObjectPtr<UTextureRenderTarget2D>> AtlasPages;
+
+        /** Packed icons -> linear cell index across all pages. */
+        TMap<FSoftObjectPath, int32> AtlasCells;
+
+        /** Cells freed by trimmed icons, reused before a new cell is taken. */
+        TArray<int32> FreeAtlasCells;
+
+        /** Atlas icon each live brush currently samples; those icons are never trimmed, so their cells are never redrawn. */
+        TMap<TWeakObjectPtr<const UObject>, FSoftObjectPath> AtlasBrushUsers;
+
+        /** Resident icons that could not be packed yet because their mips were still streaming. */
+        TSet<FSoftObjectPath> IconsAwaitingPack;
+        FTSTicker::FDelegateHandle PackRetryHandle;
+
+        int32 NextAtlasCell = 0;
+
+        /** Latched from the cvars when the first page is created; the layout cannot change afterwards. */
+        int32 AtlasCellSize = 0;
+        int32 AtlasCellsPerRow = 0;
+};
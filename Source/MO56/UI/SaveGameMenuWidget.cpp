@@ -21,6 +21,13 @@ void USaveGameMenuWidget::NativeConstruct()
         RefreshSaveEntries();
 }
 
+void USaveGameMenuWidget::NativeDestruct()
+{
+        BindSaveIndexUpdates(nullptr);
+
+        Super::NativeDestruct();
+}
+
 void USaveGameMenuWidget::SetSaveSubsystem(UMO56SaveSubsystem* Subsystem)
 {
         CachedSubsystem = Subsystem;
@@ -28,6 +35,11 @@ void USaveGameMenuWidget::SetSaveSubsystem(UMO56SaveSubsystem* Subsystem)
 }
 
 void USaveGameMenuWidget::RefreshSaveEntries()
+{
+        PopulateEntries(true);
+}
+
+void USaveGameMenuWidget::PopulateEntries(bool bRebuildIndex)
 {
         if (!SaveList)
         {
@@ -36,9 +48,12 @@ void USaveGameMenuWidget::RefreshSaveEntries()
 
         TArray<FSaveGameSummary> Summaries;
 
-        if (UMO56SaveSubsystem* Subsystem = ResolveSubsystem())
+        UMO56SaveSubsystem* Subsystem = ResolveSubsystem();
+        BindSaveIndexUpdates(Subsystem);
+
+        if (Subsystem)
         {
-                const TArray<FSaveIndexEntry> Entries = Subsystem->ListSaves();
+                const TArray<FSaveIndexEntry> Entries = Subsystem->ListSaves(bRebuildIndex);
                 for (const FSaveIndexEntry& Entry : Entries)
                 {
                         FSaveGameSummary Summary;
@@ -51,13 +66,14 @@ void USaveGameMenuWidget::RefreshSaveEntries()
                         Summary.InventoryCount = 0;
                         Summary.SaveId = Entry.SaveId;
 
-                        if (UMO56SaveGame* Header = Subsystem->PeekSaveHeader(Entry.SaveId))
+                        FMO56SaveHeader Header;
+                        if (Subsystem->PeekSaveHeader(Entry.SaveId, Header))
                         {
-                                Summary.InitialSaveTimestamp = Header->CreatedUtc;
-                                Summary.LastSaveTimestamp = Header->UpdatedUtc;
-                                Summary.TotalPlayTimeSeconds = Header->TotalPlayTimeSeconds;
-                                Summary.LastLevelName = Header->LevelName.IsEmpty() ? NAME_None : FName(*Header->LevelName);
-                                Summary.InventoryCount = Header->InventoryStates.Num();
+                                Summary.InitialSaveTimestamp = Header.CreatedUtc;
+                                Summary.LastSaveTimestamp = Header.UpdatedUtc;
+                                Summary.TotalPlayTimeSeconds = Header.TotalPlaySeconds;
+                                Summary.LastLevelName = Header.LevelName.IsEmpty() ? NAME_None : FName(*Header.LevelName);
+                                Summary.InventoryCount = Header.InventoryCount;
                         }
 
                         Summaries.Add(Summary);
@@ -141,6 +157,32 @@ void USaveGameMenuWidget::HandleEntryLoadRequested(const FSaveGameSummary& Summa
                 TEXT("SaveGameMenuWidget: No valid MO56 PlayerController. Set PlayerControllerClass to BP_MO56PlayerController in the Loading Screen map."));
 }
 
+void USaveGameMenuWidget::HandleSaveIndexUpdated()
+{
+        // The index was just rebuilt, so list it as is rather than asking for another scan.
+        PopulateEntries(false);
+}
+
+void USaveGameMenuWidget::BindSaveIndexUpdates(UMO56SaveSubsystem* Subsystem)
+{
+        if (BoundSubsystem.Get() == Subsystem)
+        {
+                return;
+        }
+
+        if (UMO56SaveSubsystem* Previous = BoundSubsystem.Get())
+        {
+                Previous->OnSaveIndexUpdated.RemoveDynamic(this, &USaveGameMenuWidget::HandleSaveIndexUpdated);
+        }
+
+        BoundSubsystem = Subsystem;
+
+        if (Subsystem)
+        {
+                Subsystem->OnSaveIndexUpdated.AddUniqueDynamic(this, &USaveGameMenuWidget::HandleSaveIndexUpdated);
+        }
+}
+
 UMO56SaveSubsystem* USaveGameMenuWidget::ResolveSubsystem() const
 {
         if (CachedSubsystem.IsValid())
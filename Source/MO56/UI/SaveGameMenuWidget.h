@@ -17,7 +17,8 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnSaveMenuLoadCompleted);
  * 1. Create a Blueprint subclass and add a ScrollBox named SaveList to host dynamically generated entries.
  * 2. Set SaveEntryWidgetClass to your USaveGameDataWidget Blueprint for consistent slot presentation.
  * 3. After constructing the menu, call SetSaveSubsystem from the PlayerController/HUD to wire persistence access.
- * 4. Invoke RefreshSaveEntries when opening the menu so the latest summaries populate the list.
+ * 4. Invoke RefreshSaveEntries when opening the menu so the latest summaries populate the list. The list shows the
+ *    cached index at once and repopulates itself when the subsystem finishes rescanning the save folder.
  * 5. Bind OnSaveLoaded to close the menu or transition gameplay once a load completes.
  */
 UCLASS()
@@ -27,6 +28,7 @@ class MO56_API USaveGameMenuWidget : public UUserWidget
 
 public:
         virtual void NativeConstruct() override;
+        virtual void NativeDestruct() override;
 
         /** Assigns the save subsystem used for data retrieval and load requests. */
         void SetSaveSubsystem(UMO56SaveSubsystem* Subsystem);
@@ -49,15 +51,24 @@ protected:
         TSubclassOf<USaveGameDataWidget> SaveEntryWidgetClass;
 
 private:
+        void PopulateEntries(bool bRebuildIndex);
         void RebuildEntries(const TArray<FSaveGameSummary>& Summaries);
 
         UFUNCTION()
         void HandleEntryLoadRequested(const FSaveGameSummary& Summary);
 
+        UFUNCTION()
+        void HandleSaveIndexUpdated();
+
+        void BindSaveIndexUpdates(UMO56SaveSubsystem* Subsystem);
+
         UMO56SaveSubsystem* ResolveSubsystem() const;
 
         TWeakObjectPtr<UMO56SaveSubsystem> CachedSubsystem;
 
+        /** Subsystem whose OnSaveIndexUpdated this menu is bound to. */
+        TWeakObjectPtr<UMO56SaveSubsystem> BoundSubsystem;
+
         UPROPERTY(Transient)
         TArray<TObjectPtr<USaveGameDataWidget>> EntryWidgets;
 };